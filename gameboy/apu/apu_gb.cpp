@@ -45,8 +45,7 @@ void APU::main() {
     wave.run();
     noise.run();
     master.run();
-
-    interface->audioSample(master.center, master.left, master.right);
+    master.synthesize();
 
     clock += 1 * cpu.frequency;
     if(clock >= 0) co_switch(scheduler.active_thread = cpu.thread);
@@ -52,6 +52,34 @@ void APU::Master::run() {
   }
 }
 
+void APU::Master::synthesize() {
+  step(0, center);
+  step(1, left);
+  step(2, right);
+  if(++counter < Divider) return;
+  counter = 0;
+
+  int16 output[3];
+  for(unsigned c = 0; c < 3; c++) {
+    accumulator[c] += buffer[c][offset];
+    buffer[c][offset] = 0;
+    output[c] = sclamp<16>(accumulator[c] >> 15);
+  }
+  offset = (offset + 1) & 31;
+
+  interface->audioSample(output[0], output[1], output[2]);
+}
+
+void APU::Master::step(unsigned channel, int16 sample) {
+  if(sample == level[channel]) return;
+  signed delta = sample - level[channel];
+  level[channel] = sample;
+
+  const int32 *taps = kernel[counter * Phases / Divider];
+  int64 *output = buffer[channel];
+  for(unsigned n = 0; n < Taps; n++) output[(offset + n) & 31] += (int64)delta * taps[n];
+}
+
 void APU::Master::write(unsigned r, uint8 data) {
   if(r == 0) {  //$ff24  NR50
     left_in_enable  = data & 0x80;
@@ -94,6 +122,14 @@ void APU::Master::power() {
   center = 0;
   left   = 0;
   right  = 0;
+
+  for(unsigned c = 0; c < 3; c++) {
+    level[c] = 0;
+    accumulator[c] = 0;
+    for(unsigned n = 0; n < 32; n++) buffer[c][n] = 0;
+  }
+  offset = 0;
+  counter = 0;
 }
 
 void APU::Master::serialize(serializer &s) {
@@ -114,6 +150,38 @@ void APU::Master::serialize(serializer &s) {
   s.integer(center);
   s.integer(left);
   s.integer(right);
+
+  s.array(level);
+  s.array(accumulator);
+  for(unsigned c = 0; c < 3; c++) s.array(buffer[c]);
+  s.integer(offset);
+  s.integer(counter);
+}
+
+int32 APU::Master::kernel[Phases][Taps];
+
+//each row is a step starting at phase/Phases of an output sample,
+//differentiated into a Blackman-windowed sinc impulse; rows sum to exactly 1 << 15
+APU::Master::Master() {
+  const double pi = 3.14159265358979323846, cutoff = 0.9;
+  for(unsigned phase = 0; phase < Phases; phase++) {
+    double impulse[Taps], sum = 0.0;
+    for(unsigned n = 0; n < Taps; n++) {
+      double x = n + 0.5 - (double)phase / Phases - Taps / 2;
+      double w = x / (Taps / 2);
+      double window = w <= -1.0 || w >= 1.0 ? 0.0 : 0.42 + 0.5 * cos(pi * w) + 0.08 * cos(2.0 * pi * w);
+      double sinc = x == 0.0 ? 1.0 : sin(pi * cutoff * x) / (pi * cutoff * x);
+      sum += impulse[n] = sinc * window;
+    }
+
+    signed total = 0;
+    unsigned peak = 0;
+    for(unsigned n = 0; n < Taps; n++) {
+      total += kernel[phase][n] = (int32)floor(impulse[n] / sum * (1 << 15) + 0.5);
+      if(kernel[phase][n] > kernel[phase][peak]) peak = n;
+    }
+    kernel[phase][peak] += (1 << 15) - total;
+  }
 }
 
 #endif
@@ -17,8 +17,21 @@ struct Master {
   int16 left;
   int16 right;
 
+  //band-limited synthesis: level changes are added as steps at 4-clock resolution,
+  //and one output sample is integrated every Divider clocks (32768hz)
+  enum { Divider = 128, Phases = 32, Taps = 16 };
+  static int32 kernel[Phases][Taps];
+  int16 level[3];
+  int64 accumulator[3];
+  int64 buffer[3][32];
+  unsigned offset;
+  unsigned counter;
+
   void run();
+  void synthesize();
+  void step(unsigned channel, int16 sample);
   void write(unsigned r, uint8 data);
   void power();
   void serialize(serializer&);
+  Master();
 };
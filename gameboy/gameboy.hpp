@@ -4,7 +4,7 @@
 namespace GameBoy {
   namespace Info {
     static const char Name[] = "bgameboy";
-    static const unsigned SerializerVersion = 3;
+    static const unsigned SerializerVersion = 4;
   }
 }
 
@@ -74,9 +74,15 @@ namespace GameBoy {
     unsigned frequency;
     int64 clock;
 
-    inline void create(void (*entrypoint)(), unsigned frequency) {
+    //threads that call out to the frontend (audio, input, file I/O) keep the deep stack;
+    //self-contained cores never nest more than a few frames and take the shallow one.
+    //libco pools stacks by size, so recreating a thread on reset reuses its old stack
+    static const unsigned DeepStack = 65536 * sizeof(void*);
+    static const unsigned ShallowStack = 16384 * sizeof(void*);
+
+    inline void create(void (*entrypoint)(), unsigned frequency, unsigned stacksize = DeepStack) {
       if(thread) co_delete(thread);
-      thread = co_create(65536 * sizeof(void*), entrypoint);
+      thread = co_create(stacksize, entrypoint);
       this->frequency = frequency;
       clock = 0;
     }
@@ -3,6 +3,8 @@ struct LCD : Processor, MMIO {
 
   struct Status {
     unsigned lx;
+    unsigned lx_pending;  //clocks run ahead of lx that the CPU has not reached yet
+    bool lx_late;
     unsigned wyc;
 
     //$ff40  LCDC
@@ -66,6 +68,8 @@ struct LCD : Processor, MMIO {
   static void Main();
   void main();
   void add_clocks(unsigned clocks);
+  unsigned lag() const;
+  unsigned position() const;
   void scanline();
   void frame();
 
@@ -25,8 +25,9 @@ void LCD::main() {
       scheduler.exit(Scheduler::ExitReason::SynchronizeEvent);
     }
 
-    add_clocks(4);
-    status.lx += 4;
+    //run ahead to the next mode boundary (Hblank or the next line) in one step;
+    //the CPU catches up before any of the events below are raised
+    add_clocks((status.lx < 252 ? 252 : 456) - status.lx);
     if(status.lx >= 456) scanline();
 
     if(status.display_enable && status.lx == 0) {
@@ -41,10 +42,40 @@ void LCD::main() {
 }
 
 void LCD::add_clocks(unsigned clocks) {
+  //an LCD that already trailed the CPU keeps raising its events one step late
+  status.lx_late = clock < 0;
+  status.lx_pending = clocks;
   clock += clocks * cpu.frequency;
-  if(clock >= 0 && scheduler.sync.i != Scheduler::SynchronizeMode::All) {
+  int64 edge = status.lx_late ? -4 * (int64)cpu.frequency : 0;
+  while(clock > edge && scheduler.sync.i != Scheduler::SynchronizeMode::All) {
     co_switch(scheduler.active_thread = cpu.thread);
   }
+
+  if(scheduler.sync.i == Scheduler::SynchronizeMode::All) {
+    //saving state: the CPU stopped short of the boundary; only commit the step it is inside of
+    unsigned unreached = lag() - 4;
+    clock -= (int64)unreached * cpu.frequency;
+    status.lx_pending -= unreached;
+  }
+
+  status.lx += status.lx_pending;
+  status.lx_pending = 0;
+}
+
+//while running ahead, the LCD sits at lx + lx_pending;
+//return how far behind that the CPU observes LX, in whole 4-clock steps
+unsigned LCD::lag() const {
+  if(status.lx_pending == 0) return 0;
+  int64 step = 4 * (int64)cpu.frequency;
+  unsigned steps = status.lx_late;
+  if(clock > 0) steps += (clock + step - 1) / step;
+  if(steps == 0) steps = 1;
+  return steps * 4 < status.lx_pending ? steps * 4 : status.lx_pending;
+}
+
+//LX as observed by the CPU
+unsigned LCD::position() const {
+  return status.lx + status.lx_pending - lag();
 }
 
 void LCD::scanline() {
@@ -82,7 +113,7 @@ unsigned LCD::hflip(unsigned data) const {
 }
 
 void LCD::power() {
-  create(Main, 4 * 1024 * 1024);
+  create(Main, 4 * 1024 * 1024, ShallowStack);
 
   for(unsigned n = 0x8000; n <= 0x9fff; n++) bus.mmio[n] = this;  //VRAM
   for(unsigned n = 0xfe00; n <= 0xfe9f; n++) bus.mmio[n] = this;  //OAM
@@ -120,6 +151,8 @@ void LCD::power() {
   foreach(n, obpd) n = 0x0000;
 
   status.lx = 0;
+  status.lx_pending = 0;
+  status.lx_late = false;
   status.wyc = 0;
 
   status.display_enable = 0;
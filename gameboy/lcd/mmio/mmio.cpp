@@ -20,10 +20,10 @@ uint8 LCD::mmio_read(uint16 addr) {
   }
 
   if(addr == 0xff41) {  //STAT
-    unsigned mode;
+    unsigned mode, lx = position();
     if(status.ly >= 144) mode = 1;  //Vblank
-    else if(status.lx < 80) mode = 2;  //OAM
-    else if(status.lx < 252) mode = 3;  //LCD
+    else if(lx < 80) mode = 2;  //OAM
+    else if(lx < 252) mode = 3;  //LCD
     else mode = 0;  //Hblank
 
     return (status.interrupt_lyc << 6)
@@ -97,6 +97,7 @@ void LCD::mmio_write(uint16 addr, uint8 data) {
   if(addr == 0xff40) {  //LCDC
     if(status.display_enable == false && (data & 0x80)) {
       status.lx = 0;  //unverified behavior; fixes Super Mario Land 2 - Tree Zone
+      if(status.lx_pending) status.lx_pending = lag();  //restart counting from the CPU's position
     }
 
     status.display_enable = data & 0x80;
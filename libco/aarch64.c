@@ -19,6 +19,8 @@
 extern "C" {
 #endif
 
+#include "pool.c"
+
 static thread_local uint64_t co_active_buffer[64];
 static thread_local cothread_t co_active_handle;
 
@@ -67,13 +69,7 @@ static void crash(void)
 cothread_t co_create(unsigned int size, void (*entrypoint)(void))
 {
    size = (size + 1023) & ~1023;
-   cothread_t handle = 0;
-#if HAVE_POSIX_MEMALIGN >= 1
-   if (posix_memalign(&handle, 1024, size + 512) < 0)
-      return 0;
-#else
-   handle = memalign(1024, size + 512);
-#endif
+   cothread_t handle = co_pool_alloc(size + 512);
 
    if (!handle)
       return handle;
@@ -114,7 +110,7 @@ cothread_t co_active(void)
 
 void co_delete(cothread_t handle)
 {
-   free(handle);
+   co_pool_free(handle);
 }
 
 void co_switch(cothread_t handle)
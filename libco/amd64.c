@@ -17,6 +17,8 @@
 extern "C" {
 #endif
 
+#include "pool.c"
+
 static thread_local long long co_active_buffer[64];
 static thread_local cothread_t co_active_handle = 0;
 #ifndef CO_USE_INLINE_ASM
@@ -170,7 +172,7 @@ cothread_t co_create(unsigned int size, void (*entrypoint)(void))
    size += 512; /* allocate additional space for storage */
    size &= ~15; /* align stack to 16-byte boundary */
 
-   if((handle = (cothread_t)malloc(size)))
+   if((handle = co_pool_alloc(size)))
    {
       long long *p = (long long*)((char*)handle + size); /* seek to top of stack */
       *--p = (long long)crash;                           /* crash if entrypoint returns */
@@ -183,7 +185,7 @@ cothread_t co_create(unsigned int size, void (*entrypoint)(void))
 
 void co_delete(cothread_t handle)
 {
-   free(handle);
+   co_pool_free(handle);
 }
 
 void co_switch(cothread_t handle)
@@ -0,0 +1,93 @@
+/*
+  libco.pool
+  stack allocator shared by the amd64 and aarch64 backends
+  license: public domain
+*/
+
+/*
+  co_delete() parks stacks here instead of releasing them, and co_create() hands
+  a parked stack of the same size back out. Every reset recreates each processor
+  thread with the size it had before, so resets no longer churn the allocator.
+  Where mmap is available each stack sits directly above an inaccessible guard
+  page, so an overflow faults instead of corrupting the neighbouring heap.
+  The block size is kept in a 16-byte header just below the handle.
+*/
+
+#include <stdlib.h>
+
+#if !defined(_WIN32)
+  #include <unistd.h>
+  #include <sys/mman.h>
+  #define CO_POOL_MMAP
+#endif
+
+#define CO_POOL_SLOTS 16
+#define CO_POOL_HEADER 16
+
+static thread_local cothread_t co_pool[CO_POOL_SLOTS];
+static thread_local unsigned int co_pool_count = 0;
+
+static unsigned int *co_pool_header(cothread_t handle)
+{
+  return (unsigned int*)((char*)handle - CO_POOL_HEADER);
+}
+
+#ifdef CO_POOL_MMAP
+static size_t co_pool_page(void)
+{
+  static size_t page = 0;
+  if(!page) page = sysconf(_SC_PAGESIZE);
+  return page;
+}
+
+static size_t co_pool_span(unsigned int size)
+{
+  size_t page = co_pool_page();
+  return page + ((CO_POOL_HEADER + size + page - 1) & ~(page - 1));
+}
+#endif
+
+/* size must already include backend storage; the block is 16-byte aligned */
+static cothread_t co_pool_alloc(unsigned int size)
+{
+  unsigned int i;
+  char *base;
+
+  for(i = 0; i < co_pool_count; i++) {
+    cothread_t handle = co_pool[i];
+    if(*co_pool_header(handle) != size) continue;
+    co_pool[i] = co_pool[--co_pool_count];
+    return handle;
+  }
+
+#ifdef CO_POOL_MMAP
+  base = (char*)mmap(0, co_pool_span(size), PROT_READ | PROT_WRITE,
+    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if(base == (char*)MAP_FAILED) return 0;
+  mprotect(base, co_pool_page(), PROT_NONE);
+  base += co_pool_page();
+#else
+  if(!(base = (char*)malloc(CO_POOL_HEADER + size))) return 0;
+#endif
+
+  *(unsigned int*)base = size;
+  return (cothread_t)(base + CO_POOL_HEADER);
+}
+
+static void co_pool_free(cothread_t handle)
+{
+  char *base;
+
+  if(!handle) return;
+  if(co_pool_count < CO_POOL_SLOTS) {
+    co_pool[co_pool_count++] = handle;
+    return;
+  }
+
+  base = (char*)co_pool_header(handle);
+#ifdef CO_POOL_MMAP
+  munmap(base - co_pool_page(), co_pool_span(*(unsigned int*)base));
+#else
+  free(base);
+#endif
+}
@@ -19,16 +19,16 @@
 namespace nall {
   class filemap {
   public:
-    enum class mode : unsigned { read, write, readwrite, writeread };
+    struct mode { enum e { read, write, readwrite, writeread, copyonwrite }; };
 
     bool open() const { return p_open(); }
-    bool open(const char *filename, mode mode_) { return p_open(filename, mode_); }
+    bool open(const char *filename, mode::e mode_) { return p_open(filename, mode_); }
     void close() { return p_close(); }
     unsigned size() const { return p_size; }
     uint8_t* data() { return p_handle; }
     const uint8_t* data() const { return p_handle; }
     filemap() : p_size(0), p_handle(0) { p_ctor(); }
-    filemap(const char *filename, mode mode_) : p_size(0), p_handle(0) { p_ctor(); p_open(filename, mode_); }
+    filemap(const char *filename, mode::e mode_) : p_size(0), p_handle(0) { p_ctor(); p_open(filename, mode_); }
     ~filemap() { p_dtor(); }
 
   private:
@@ -46,7 +46,7 @@ namespace nall {
       return p_handle;
     }
 
-    bool p_open(const char *filename, mode mode_) {
+    bool p_open(const char *filename, mode::e mode_) {
       int desired_access, creation_disposition, flprotect, map_access;
 
       switch(mode_) {
@@ -76,6 +76,13 @@ namespace nall {
           flprotect = PAGE_READWRITE;
           map_access = FILE_MAP_ALL_ACCESS;
           break;
+        case mode::copyonwrite:
+          //private view: written pages are copied, the file is never modified
+          desired_access = GENERIC_READ;
+          creation_disposition = OPEN_EXISTING;
+          flprotect = PAGE_WRITECOPY;
+          map_access = FILE_MAP_COPY;
+          break;
       }
 
       p_filehandle = CreateFileW(utf16_t(filename), desired_access, FILE_SHARE_READ, NULL,
@@ -132,8 +139,8 @@ namespace nall {
       return p_handle;
     }
 
-    bool p_open(const char *filename, mode mode_) {
-      int open_flags, mmap_flags;
+    bool p_open(const char *filename, mode::e mode_) {
+      int open_flags, mmap_flags, mmap_share = MAP_SHARED;
 
       switch(mode_) {
         default: return false;
@@ -153,6 +160,12 @@ namespace nall {
           open_flags = O_RDWR | O_CREAT;
           mmap_flags = PROT_READ | PROT_WRITE;
           break;
+        case mode::copyonwrite:
+          //private mapping: written pages are copied, the file is never modified
+          open_flags = O_RDONLY;
+          mmap_flags = PROT_READ | PROT_WRITE;
+          mmap_share = MAP_PRIVATE;
+          break;
       }
 
       p_fd = ::open(filename, open_flags, S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
@@ -162,7 +175,7 @@ namespace nall {
       fstat(p_fd, &p_stat);
       p_size = p_stat.st_size;
 
-      p_handle = (uint8_t*)mmap(0, p_size, mmap_flags, MAP_SHARED, p_fd, 0);
+      p_handle = (uint8_t*)mmap(0, p_size, mmap_flags, mmap_share, p_fd, 0);
       if(p_handle == MAP_FAILED) {
         p_handle = 0;
         ::close(p_fd);
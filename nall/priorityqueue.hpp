@@ -61,6 +61,11 @@ namespace nall {
       return event;
     }
 
+    //ticks left before the next event fires
+    unsigned remaining() const {
+      return heapsize ? heap[0].counter - basecounter : std::numeric_limits<unsigned>::max() >> 1;
+    }
+
     void reset() {
       basecounter = 0;
       heapsize = 0;
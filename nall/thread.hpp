@@ -0,0 +1,171 @@
+#ifndef NALL_THREAD_HPP
+#define NALL_THREAD_HPP
+
+//minimal OS thread, mutex and condition variable wrappers;
+//only the operations needed to hand work to a single helper thread.
+//atomic_load() and atomic_store() are sequentially consistent, so a counter
+//published with atomic_store() also publishes every write made before it.
+
+#if defined(_WIN32)
+  #include <windows.h>
+#else
+  #include <pthread.h>
+  #include <unistd.h>
+#endif
+
+namespace nall {
+  inline unsigned atomic_load(const volatile unsigned &value) {
+    #if defined(_WIN32)
+    MemoryBarrier();
+    unsigned result = value;
+    MemoryBarrier();
+    return result;
+    #elif defined(__ATOMIC_SEQ_CST)
+    return __atomic_load_n(&value, __ATOMIC_SEQ_CST);
+    #else
+    __sync_synchronize();
+    unsigned result = value;
+    __sync_synchronize();
+    return result;
+    #endif
+  }
+
+  inline void atomic_store(volatile unsigned &value, unsigned data) {
+    #if defined(_WIN32)
+    InterlockedExchange((volatile LONG*)&value, data);
+    #elif defined(__ATOMIC_SEQ_CST)
+    __atomic_store_n(&value, data, __ATOMIC_SEQ_CST);
+    #else
+    __sync_synchronize();
+    value = data;
+    __sync_synchronize();
+    #endif
+  }
+
+  //processors the host has online; a helper thread only pays off with two or more
+  inline unsigned processors() {
+    #if defined(_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwNumberOfProcessors;
+    #else
+    long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? count : 1;
+    #endif
+  }
+
+  //hint for busy-wait loops
+  inline void spin_pause() {
+    #if defined(_WIN32)
+    YieldProcessor();
+    #elif defined(__i386__) || defined(__x86_64__)
+    __asm__ __volatile__("pause");
+    #endif
+  }
+
+  class mutex {
+  public:
+    #if defined(_WIN32)
+    void lock() { EnterCriticalSection(&handle); }
+    void unlock() { LeaveCriticalSection(&handle); }
+    mutex() { InitializeCriticalSection(&handle); }
+    ~mutex() { DeleteCriticalSection(&handle); }
+    #else
+    void lock() { pthread_mutex_lock(&handle); }
+    void unlock() { pthread_mutex_unlock(&handle); }
+    mutex() { pthread_mutex_init(&handle, 0); }
+    ~mutex() { pthread_mutex_destroy(&handle); }
+    #endif
+
+  private:
+    #if defined(_WIN32)
+    CRITICAL_SECTION handle;
+    #else
+    pthread_mutex_t handle;
+    #endif
+    friend class condition;
+    mutex(const mutex&);
+    mutex& operator=(const mutex&);
+  };
+
+  //wait() must be called with the mutex held; it is held again on return
+  class condition {
+  public:
+    #if defined(_WIN32)
+    void wait(mutex &m) { SleepConditionVariableCS(&handle, &m.handle, INFINITE); }
+    void signal() { WakeConditionVariable(&handle); }
+    void broadcast() { WakeAllConditionVariable(&handle); }
+    condition() { InitializeConditionVariable(&handle); }
+    ~condition() {}
+    #else
+    void wait(mutex &m) { pthread_cond_wait(&handle, &m.handle); }
+    void signal() { pthread_cond_signal(&handle); }
+    void broadcast() { pthread_cond_broadcast(&handle); }
+    condition() { pthread_cond_init(&handle, 0); }
+    ~condition() { pthread_cond_destroy(&handle); }
+    #endif
+
+  private:
+    #if defined(_WIN32)
+    CONDITION_VARIABLE handle;
+    #else
+    pthread_cond_t handle;
+    #endif
+    condition(const condition&);
+    condition& operator=(const condition&);
+  };
+
+  class thread {
+  public:
+    bool active() const { return running; }
+
+    bool create(void (*entry)(void*), void *parameter) {
+      if(running) return false;
+      p_entry = entry;
+      p_parameter = parameter;
+      #if defined(_WIN32)
+      handle = CreateThread(0, 0, p_start, (void*)this, 0, 0);
+      running = handle != 0;
+      #else
+      running = pthread_create(&handle, 0, p_start, (void*)this) == 0;
+      #endif
+      return running;
+    }
+
+    void join() {
+      if(!running) return;
+      #if defined(_WIN32)
+      WaitForSingleObject(handle, INFINITE);
+      CloseHandle(handle);
+      #else
+      pthread_join(handle, 0);
+      #endif
+      running = false;
+    }
+
+    thread() : running(false), p_entry(0), p_parameter(0) {}
+    ~thread() { join(); }
+
+  private:
+    bool running;
+    void (*p_entry)(void*);
+    void *p_parameter;
+    #if defined(_WIN32)
+    HANDLE handle;
+    static DWORD WINAPI p_start(void *self) {
+      ((thread*)self)->p_entry(((thread*)self)->p_parameter);
+      return 0;
+    }
+    #else
+    pthread_t handle;
+    static void* p_start(void *self) {
+      ((thread*)self)->p_entry(((thread*)self)->p_parameter);
+      return 0;
+    }
+    #endif
+    thread(const thread&);
+    thread& operator=(const thread&);
+  };
+}
+
+#endif
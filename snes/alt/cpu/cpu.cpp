@@ -17,22 +17,32 @@ namespace SNES {
 #include "timing.cpp"
 
 void CPU::step(unsigned clocks) {
+  #if defined(THREADED_APU)
+  smp.worker.clocks += clocks;
+  #else
   smp.clock -= clocks * (uint64)smp.frequency;
+  #endif
   ppu.clock -= clocks;
   for(unsigned i = 0; i < coprocessors.size(); i++) {
     Processor &chip = *coprocessors[i];
     chip.clock -= clocks * (uint64)chip.frequency;
   }
-  input.port1->clock -= clocks * (uint64)input.port1->frequency;
-  input.port2->clock -= clocks * (uint64)input.port2->frequency;
-  synchronize_controllers();
+  if(input.threaded) {
+    input.port1->clock -= clocks * (uint64)input.port1->frequency;
+    input.port2->clock -= clocks * (uint64)input.port2->frequency;
+    synchronize_controllers();
+  }
 }
 
 void CPU::synchronize_smp() {
   if(SMP::Threaded == true) {
     if(smp.clock < 0) co_switch(smp.thread);
   } else {
+    #if defined(THREADED_APU)
+    smp.worker.flush();
+    #else
     while(smp.clock < 0) smp.enter();
+    #endif
   }
 }
 
@@ -46,14 +56,16 @@ void CPU::synchronize_ppu() {
 
 void CPU::synchronize_coprocessors() {
   for(unsigned i = 0; i < coprocessors.size(); i++) {
-    Processor &chip = *coprocessors[i];
-    if(chip.clock < 0) co_switch(chip.thread);
+    Coprocessor &chip = *coprocessors[i];
+    if(chip.clock >= 0) continue;
+    if(chip.asleep) chip.idle();
+    else co_switch(chip.thread);
   }
 }
 
 void CPU::synchronize_controllers() {
-  if(input.port1->clock < 0) co_switch(input.port1->thread);
-  if(input.port2->clock < 0) co_switch(input.port2->thread);
+  if(input.port1->thread && input.port1->clock < 0) co_switch(input.port1->thread);
+  if(input.port2->thread && input.port2->clock < 0) co_switch(input.port2->thread);
 }
 
 void CPU::Enter() { cpu.enter(); }
@@ -112,9 +124,9 @@ void CPU::enable() {
   read = function<uint8(unsigned)>(cpu_wram_reader);
   write = function<void(unsigned,uint8)>(cpu_wram_writer);
 
-  bus.map(Bus::MapMode::Linear, 0x00, 0x3f, 0x0000, 0x1fff, read, write, 0x000000, 0x002000);
-  bus.map(Bus::MapMode::Linear, 0x80, 0xbf, 0x0000, 0x1fff, read, write, 0x000000, 0x002000);
-  bus.map(Bus::MapMode::Linear, 0x7e, 0x7f, 0x0000, 0xffff, read, write);
+  bus.passive[bus.map(Bus::MapMode::Linear, 0x00, 0x3f, 0x0000, 0x1fff, read, write, 0x000000, 0x002000)] = true;
+  bus.passive[bus.map(Bus::MapMode::Linear, 0x80, 0xbf, 0x0000, 0x1fff, read, write, 0x000000, 0x002000)] = true;
+  bus.passive[bus.map(Bus::MapMode::Linear, 0x7e, 0x7f, 0x0000, 0xffff, read, write)] = true;
 }
 
 void CPU::power() {
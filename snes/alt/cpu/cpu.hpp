@@ -3,7 +3,7 @@ public:
   uint8 wram[128 * 1024];
 
   enum{ Threaded = true };
-  array<Processor*> coprocessors;
+  array<Coprocessor*> coprocessors;
   alwaysinline void step(unsigned clocks);
   alwaysinline void synchronize_smp();
   void synchronize_ppu();
@@ -41,6 +41,8 @@ private:
     enum{
       DramRefresh,
       HdmaRun,
+      ControllerLatch1,
+      ControllerLatch2,
     };
   };
   nall::priority_queue<unsigned> queue;
@@ -60,10 +62,13 @@ private:
   void dma_write(bool valid, unsigned addr, uint8 data);
   void dma_transfer(bool direction, uint8 bbus, unsigned abus);
   uint8 dma_bbus(unsigned i, unsigned index);
+  unsigned dma_window();
+  unsigned dma_burst(unsigned i);
   unsigned dma_addr(unsigned i);
   unsigned hdma_addr(unsigned i);
   unsigned hdma_iaddr(unsigned i);
   void dma_run();
+  unsigned hdma_burst();
   bool hdma_active_after(unsigned i);
   void hdma_update(unsigned i);
   void hdma_run();
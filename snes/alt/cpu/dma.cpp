@@ -63,6 +63,57 @@ unsigned CPU::dma_addr(unsigned i) {
   return result;
 }
 
+//clocks that may pass in a single add_clocks() call before the scanline edge,
+//the next queued event, the IRQ test point or, on active lines, the dot where
+//the PPU renders the line (PPU::enter) has to be observed
+unsigned CPU::dma_window() {
+  unsigned clocks = lineclocks() - hcounter();
+  if(vcounter() && vcounter() < (ppu.overscan() == false ? 225 : 240) && hcounter() < 512) {
+    clocks = 512 - hcounter();
+  }
+  clocks = min(clocks, queue.remaining());
+  if(status.hirq_enabled) {
+    unsigned cpu_time = hcounter();
+    unsigned irq_time = status.htime * 4;
+    unsigned period = 1364;
+    if(status.virq_enabled) {
+      cpu_time += vcounter() * 1364;
+      irq_time += status.vtime * 1364;
+      period = ((system.region.i == System::Region::NTSC ? 262 : 312) + field()) * 1364;
+    }
+    if(cpu_time > irq_time) irq_time += period;
+    clocks = min(clocks, irq_time - cpu_time + 1);
+  }
+  return clocks;
+}
+
+//number of bytes channel i may move now as one block, with a single add_clocks() for all of them.
+//this holds while the transfer goes from passive memory to the PPU data ports or WRAM, and no
+//scanline edge, queued event, IRQ test point or render dot falls before the last byte is written.
+unsigned CPU::dma_burst(unsigned i) {
+  if(channel[i].direction == 1 || input.threaded) return 0;
+  for(unsigned index = 0; index < 4; index++) {
+    switch(dma_bbus(i, index)) {
+      case 0x04: case 0x18: case 0x19: case 0x22: case 0x80: break;
+      default: return 0;
+    }
+  }
+
+  unsigned clocks = dma_window();
+  if(clocks == 0) return 0;
+
+  unsigned length = (clocks - 1) >> 3;
+  unsigned remaining = channel[i].transfer_size ? channel[i].transfer_size : 0x10000;
+  if(length > remaining) length = remaining;
+
+  uint16 addr = channel[i].source_addr;
+  signed step = channel[i].fixed_transfer ? 0 : channel[i].reverse_transfer ? -1 : +1;
+  for(unsigned n = 0; n < length; n++, addr += step) {
+    if(bus.passive[bus.lookup[(channel[i].source_bank << 16) | addr]] == false) return n;
+  }
+  return length;
+}
+
 unsigned CPU::hdma_addr(unsigned i) {
   return (channel[i].source_bank << 16) | (channel[i].hdma_addr++);
 }
@@ -80,7 +131,19 @@ void CPU::dma_run() {
 
     unsigned index = 0;
     do {
-      dma_transfer(channel[i].direction, dma_bbus(i, index++), dma_addr(i));
+      unsigned burst = dma_burst(i);
+      if(burst == 0) {
+        dma_transfer(channel[i].direction, dma_bbus(i, index++), dma_addr(i));
+        continue;
+      }
+
+      for(unsigned n = 0; n < burst; n++) {
+        uint8 bbus = dma_bbus(i, index++);
+        unsigned abus = dma_addr(i);
+        dma_write(dma_transfer_valid(bbus, abus), 0x2100 | bbus, dma_read(abus));
+      }
+      add_clocks(burst << 3);
+      channel[i].transfer_size -= burst - 1;
     } while(channel[i].dma_enabled && --channel[i].transfer_size);
 
     channel[i].dma_enabled = false;
@@ -117,6 +180,34 @@ void CPU::hdma_update(unsigned i) {
   }
 }
 
+//clocks taken by this scanline's HDMA transfers if they may all run as one block:
+//every active channel reads passive memory and writes PPU registers ($2100-213f),
+//which only take effect when the PPU renders the next line, and the whole block
+//ends before the scanline edge, queued event or IRQ test point. returns 0 otherwise.
+unsigned CPU::hdma_burst() {
+  static const unsigned transfer_length[] = { 1, 2, 2, 4, 4, 4, 2, 4 };
+  if(input.threaded) return 0;
+
+  unsigned clocks = 0;
+  for(unsigned i = 0; i < 8; i++) {
+    if(channel[i].hdma_enabled == false || channel[i].hdma_completed == true) continue;
+    if(channel[i].hdma_do_transfer == false) continue;
+    if(channel[i].direction == 1) return 0;
+
+    unsigned bank = channel[i].indirect == false ? channel[i].source_bank : channel[i].indirect_bank;
+    uint16 addr = channel[i].indirect == false ? channel[i].hdma_addr : channel[i].indirect_addr;
+    unsigned length = transfer_length[channel[i].transfer_mode];
+    for(unsigned index = 0; index < length; index++, addr++) {
+      if(dma_bbus(i, index) >= 0x40) return 0;
+      if(bus.passive[bus.lookup[(bank << 16) | addr]] == false) return 0;
+    }
+    clocks += length << 3;
+  }
+
+  if(clocks == 0 || clocks >= dma_window()) return 0;
+  return clocks;
+}
+
 void CPU::hdma_run() {
   unsigned channels = 0;
   for(unsigned i = 0; i < 8; i++) {
@@ -125,6 +216,7 @@ void CPU::hdma_run() {
   if(channels == 0) return;
 
   add_clocks(16);
+  unsigned burst = hdma_burst();
   for(unsigned i = 0; i < 8; i++) {
     if(channel[i].hdma_enabled == false || channel[i].hdma_completed == true) continue;
     channel[i].dma_enabled = false;
@@ -134,10 +226,15 @@ void CPU::hdma_run() {
       unsigned length = transfer_length[channel[i].transfer_mode];
       for(unsigned index = 0; index < length; index++) {
         unsigned addr = channel[i].indirect == false ? hdma_addr(i) : hdma_iaddr(i);
-        dma_transfer(channel[i].direction, dma_bbus(i, index), addr);
+        if(burst) {
+          bus.write(0x2100 | dma_bbus(i, index), bus.read(addr));
+        } else {
+          dma_transfer(channel[i].direction, dma_bbus(i, index), addr);
+        }
       }
     }
   }
+  if(burst) add_clocks(burst);
 
   for(unsigned i = 0; i < 8; i++) {
     if(channel[i].hdma_enabled == false || channel[i].hdma_completed == true) continue;
@@ -3,6 +3,9 @@
 uint8 CPU::mmio_read(unsigned addr) {
   if((addr & 0xffc0) == 0x2140) {
     synchronize_smp();
+    #if defined(THREADED_APU)
+    smp.worker.synchronize();
+    #endif
     return smp.port_read(addr & 3);
   }
 
@@ -100,7 +103,11 @@ uint8 CPU::mmio_read(unsigned addr) {
 void CPU::mmio_write(unsigned addr, uint8 data) {
   if((addr & 0xffc0) == 0x2140) {
     synchronize_smp();
+    #if defined(THREADED_APU)
+    smp.worker.port_write(addr & 3, data);
+    #else
     port_write(addr & 3, data);
+    #endif
     return;
   }
 
@@ -4,6 +4,8 @@ void CPU::queue_event(unsigned id) {
   switch(id) {
     case QueueEvent::DramRefresh: return add_clocks(40);
     case QueueEvent::HdmaRun: return hdma_run();
+    case QueueEvent::ControllerLatch1: return input.port1->raster_latch();
+    case QueueEvent::ControllerLatch2: return input.port2->raster_latch();
   }
 }
 
@@ -72,6 +74,10 @@ void CPU::scanline() {
     queue.enqueue(1104 + 8, QueueEvent::HdmaRun);
   }
 
+  signed position;
+  if((position = input.port1->raster_position()) >= 0) queue.enqueue(position, QueueEvent::ControllerLatch1);
+  if((position = input.port2->raster_position()) >= 0) queue.enqueue(position, QueueEvent::ControllerLatch2);
+
   bool nmi_valid = status.nmi_valid;
   status.nmi_valid = vcounter() >= (ppu.overscan() == false ? 225 : 240);
   if(!nmi_valid && status.nmi_valid) {
@@ -135,20 +135,52 @@ static short const gauss [512] =
 1299,1300,1300,1301,1302,1302,1303,1303,1303,1304,1304,1304,1304,1304,1305,1305,
 };
 
+// Gaussian taps regrouped per fractional position, in the order interpolate()
+// applies them, so that each sample needs a single 8-byte table load
+static short gauss_taps [256] [4];
+
+static void init_gauss_taps()
+{
+	for ( int offset = 0; offset < 256; offset++ )
+	{
+		gauss_taps [offset] [0] = gauss [255 - offset];
+		gauss_taps [offset] [1] = gauss [511 - offset];
+		gauss_taps [offset] [2] = gauss [256 + offset];
+		gauss_taps [offset] [3] = gauss [      offset];
+	}
+}
+
 inline int SPC_DSP::interpolate( voice_t const* v )
 {
 	// Make pointers into gaussian based on fractional position between samples
 	int offset = v->interp_pos >> 4 & 0xFF;
-	short const* fwd = gauss + 255 - offset;
-	short const* rev = gauss       + offset; // mirror left half of gaussian
+	short const* taps = gauss_taps [offset];
 
+	// Decoded samples are always within 16 bits, so every product fits in 32
 	int const* in = &v->buf [(v->interp_pos >> 12) + v->buf_pos];
 	int out;
-	out  = (fwd [  0] * in [0]) >> 11;
-	out += (fwd [256] * in [1]) >> 11;
-	out += (rev [256] * in [2]) >> 11;
+#if SPC_DSP_SSE2
+	__m128i const t = _mm_loadl_epi64( (__m128i const*) taps );
+	__m128i s = _mm_loadu_si128( (__m128i const*) in );
+	s = _mm_packs_epi32( s, s );
+	__m128i const p = _mm_srai_epi32( _mm_unpacklo_epi16(
+			_mm_mullo_epi16( t, s ), _mm_mulhi_epi16( t, s ) ), 11 );
+	__m128i const q = _mm_add_epi32( p, _mm_shuffle_epi32( p, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+	out  = _mm_cvtsi128_si32( q ) + _mm_cvtsi128_si32( _mm_srli_si128( p, 8 ) );
 	out = (int16_t) out;
-	out += (rev [  0] * in [3]) >> 11;
+	out += _mm_cvtsi128_si32( _mm_srli_si128( p, 12 ) );
+#elif SPC_DSP_NEON
+	int32x4_t const p = vshrq_n_s32( vmull_s16( vld1_s16( taps ), vmovn_s32( vld1q_s32( in ) ) ), 11 );
+	out  = vgetq_lane_s32( p, 0 ) + vgetq_lane_s32( p, 1 ) + vgetq_lane_s32( p, 2 );
+	out = (int16_t) out;
+	out += vgetq_lane_s32( p, 3 );
+#else
+	out  = (taps [0] * in [0]) >> 11;
+	out += (taps [1] * in [1]) >> 11;
+	out += (taps [2] * in [2]) >> 11;
+	out = (int16_t) out;
+	out += (taps [3] * in [3]) >> 11;
+#endif
 
 	CLAMP16( out );
 	out &= ~1;
@@ -307,6 +339,24 @@ inline void SPC_DSP::decode_brr( voice_t* v )
 	if ( (v->buf_pos += 4) >= brr_buf_size )
 		v->buf_pos = 0;
 
+	// Looped instrument samples decode the same bytes from the same history
+	// over and over
+	int const addr = (v->brr_addr + v->brr_offset) & 0xFFFF;
+	brr_cache_t* const cache = &brr_cache [(addr ^ addr >> 10) & (brr_cache_size - 1)];
+	int const tag = nybbles | header << 16;
+	int const hist1 = (header & 0x0C) ? pos [brr_buf_size - 1] : 0;
+	int const hist2 = (header & 0x0C) ? pos [brr_buf_size - 2] : 0;
+	if ( cache->tag == tag && cache->p1 == hist1 && cache->p2 == hist2 )
+	{
+		for ( int i = 0; i < 4; i++ )
+			pos [brr_buf_size + i] = pos [i] = cache->out [i];
+		return;
+	}
+	cache->tag = tag;
+	cache->p1  = hist1;
+	cache->p2  = hist2;
+	int* out = cache->out;
+
 	// Decode four samples
 	for ( end = pos + 4; pos < end; pos++, nybbles <<= 4 )
 	{
@@ -347,7 +397,7 @@ inline void SPC_DSP::decode_brr( voice_t* v )
 		// Adjust and write sample
 		CLAMP16( s );
 		s = (int16_t) (s * 2);
-		pos [brr_buf_size] = pos [0] = s; // second copy simplifies wrap-around
+		pos [brr_buf_size] = pos [0] = *out++ = s; // second copy simplifies wrap-around
 	}
 }
 
@@ -819,6 +869,9 @@ void SPC_DSP::run( int clocks_remain )
 void SPC_DSP::init( void* ram_64k )
 {
 	m.ram = (uint8_t*) ram_64k;
+	init_gauss_taps();
+	for ( int i = 0; i < brr_cache_size; i++ )
+		brr_cache [i].tag = -1;
 	mute_voices( 0 );
 	disable_surround( false );
 	set_output( 0, 0 );
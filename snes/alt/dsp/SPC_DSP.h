@@ -187,6 +187,18 @@ private:
 	};
 	state_t m;
 
+	// Decoded BRR nybble pairs, looked up by RAM address and tagged with
+	// everything decode_brr() depends on, so a stale entry can never match
+	// and RAM writes need no invalidation. Derived data; never saved.
+	enum { brr_cache_size = 1024 };
+	struct brr_cache_t
+	{
+		int tag;     // nybbles | header << 16, or -1 when empty
+		int p1, p2;  // filter history (zero for filter 0, which ignores it)
+		int out [4];
+	};
+	brr_cache_t brr_cache [brr_cache_size];
+
 	void init_counter();
 	void run_counters();
 	unsigned read_counter( int rate );
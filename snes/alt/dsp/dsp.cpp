@@ -1,5 +1,14 @@
 #include <snes/snes.hpp>
 
+//vector units used by SPC_DSP::interpolate()
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+  #define SPC_DSP_SSE2 1
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+  #include <arm_neon.h>
+  #define SPC_DSP_NEON 1
+#endif
+
 #define DSP_CPP
 namespace SNES {
 
@@ -26,7 +35,13 @@ void DSP::enter() {
 
   signed count = spc_dsp.sample_count();
   if(count > 0) {
-    for(unsigned n = 0; n < count; n += 2) audio.sample(samplebuffer[n + 0], samplebuffer[n + 1]);
+    for(unsigned n = 0; n < count; n += 2) {
+      #if defined(THREADED_APU)
+      smp.worker.sample(samplebuffer[n + 0], samplebuffer[n + 1]);
+      #else
+      audio.sample(samplebuffer[n + 0], samplebuffer[n + 1]);
+      #endif
+    }
     spc_dsp.set_output(samplebuffer, 8192);
   }
 }
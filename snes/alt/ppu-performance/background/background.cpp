@@ -11,6 +11,7 @@ unsigned PPU::Background::get_tile(unsigned hoffset, unsigned voffset) {
   if(tile_x & 0x20) tile_pos += scx;
 
   const uint16 tiledata_addr = regs.screen_addr + (tile_pos << 1);
+  self.memo.touch(tiledata_addr, 2);
   return (ppu.vram[tiledata_addr + 0] << 0) + (ppu.vram[tiledata_addr + 1] << 8);
 }
 
@@ -129,6 +130,7 @@ void PPU::Background::render() {
     if(mirror_y) voffset ^= 7;
     unsigned mirror_xmask = !mirror_x ? 0 : 7;
 
+    self.memo.touch(tile_num << (4 + regs.mode), 16 << regs.mode);
     uint8 *tiledata = self.cache.tile(regs.mode, tile_num);
     tiledata += ((voffset & 7) * 8);
 
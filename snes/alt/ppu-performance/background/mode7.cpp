@@ -4,7 +4,7 @@
 
 void PPU::Background::render_mode7() {
   signed px, py;
-  signed tx, ty, tile, palette;
+  signed tile, palette;
 
   signed a = sclip<16>(self.regs.m7a);
   signed b = sclip<16>(self.regs.m7b);
@@ -30,52 +30,66 @@ void PPU::Background::render_mode7() {
   unsigned priority0 = (priority0_enable ? regs.priority0 : 0);
   unsigned priority1 = (priority1_enable ? regs.priority1 : 0);
   if(priority0 + priority1 == 0) return;
+  self.memo.touch(0x0000, 0x8000);
 
   signed psx = ((a * Clip(hofs - cx)) & ~63) + ((b * Clip(vofs - cy)) & ~63) + ((b * mosaic_y[y]) & ~63) + (cx << 8);
   signed psy = ((c * Clip(hofs - cx)) & ~63) + ((d * Clip(vofs - cy)) & ~63) + ((d * mosaic_y[y]) & ~63) + (cy << 8);
-  for(signed x = 0; x < 256; x++) {
-    px = (psx + (a * mosaic_x[x])) >> 8;
-    py = (psy + (c * mosaic_x[x])) >> 8;
-
-    switch(self.regs.mode7_repeat) {
-      case 0: case 1: {
-        px &= 1023;
-        py &= 1023;
-        tx = ((px >> 3) & 127);
-        ty = ((py >> 3) & 127);
-        tile = ppu.vram[(ty * 128 + tx) << 1];
-        palette = ppu.vram[(((tile << 6) + ((py & 7) << 3) + (px & 7)) << 1) + 1];
-        break;
+
+  //the line is rendered in passes: all 256 texel coordinates first (without mosaic
+  //they simply advance by a and c per pixel, which the compiler vectorizes), then
+  //one texel fetch loop per repeat mode, then the plot loop
+  signed pxs[256], pys[256];
+  uint8 palettes[256];
+  if(mosaic_x == mosaic_table[0]) {
+    for(signed x = 0; x < 256; x++) {
+      pxs[x] = (psx + a * x) >> 8;
+      pys[x] = (psy + c * x) >> 8;
+    }
+  } else {
+    for(signed x = 0; x < 256; x++) {
+      pxs[x] = (psx + (a * mosaic_x[x])) >> 8;
+      pys[x] = (psy + (c * mosaic_x[x])) >> 8;
+    }
+  }
+
+  switch(self.regs.mode7_repeat) {
+    case 0: case 1: {
+      for(signed x = 0; x < 256; x++) {
+        px = pxs[x] & 1023;
+        py = pys[x] & 1023;
+        tile = ppu.vram[((py >> 3) * 128 + (px >> 3)) << 1];
+        palettes[x] = ppu.vram[(((tile << 6) + ((py & 7) << 3) + (px & 7)) << 1) + 1];
       }
+      break;
+    }
 
-      case 2: {
+    case 2: {
+      for(signed x = 0; x < 256; x++) {
+        px = pxs[x];
+        py = pys[x];
         if((px | py) & ~1023) {
-          palette = 0;
-        } else {
-          px &= 1023;
-          py &= 1023;
-          tx = ((px >> 3) & 127);
-          ty = ((py >> 3) & 127);
-          tile = ppu.vram[(ty * 128 + tx) << 1];
-          palette = ppu.vram[(((tile << 6) + ((py & 7) << 3) + (px & 7)) << 1) + 1];
+          palettes[x] = 0;
+          continue;
         }
-        break;
+        tile = ppu.vram[((py >> 3) * 128 + (px >> 3)) << 1];
+        palettes[x] = ppu.vram[(((tile << 6) + ((py & 7) << 3) + (px & 7)) << 1) + 1];
       }
+      break;
+    }
 
-      case 3: {
-        if((px | py) & ~1023) {
-          tile = 0;
-        } else {
-          px &= 1023;
-          py &= 1023;
-          tx = ((px >> 3) & 127);
-          ty = ((py >> 3) & 127);
-          tile = ppu.vram[(ty * 128 + tx) << 1];
-        }
-        palette = ppu.vram[(((tile << 6) + ((py & 7) << 3) + (px & 7)) << 1) + 1];
-        break;
+    case 3: {
+      for(signed x = 0; x < 256; x++) {
+        px = pxs[x];
+        py = pys[x];
+        tile = ((px | py) & ~1023) ? 0 : ppu.vram[((py >> 3) * 128 + (px >> 3)) << 1];
+        palettes[x] = ppu.vram[(((tile << 6) + ((py & 7) << 3) + (px & 7)) << 1) + 1];
       }
+      break;
     }
+  }
+
+  for(signed x = 0; x < 256; x++) {
+    palette = palettes[x];
 
     unsigned priority;
     if(id == ID::BG1) {
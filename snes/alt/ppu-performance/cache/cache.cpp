@@ -1,8 +1,13 @@
 #ifdef PPU_CPP
 
+//VRAM writes only mark their granule dirty; a tile is reconverted for one format when it is
+//next drawn in that format and any granule it spans is dirty, so formats no layer uses are
+//never converted at all.
+
 uint8* PPU::Cache::tile_2bpp(unsigned tile) {
-  if(tilevalid[0][tile] == 0) {
-    tilevalid[0][tile] = 1;
+  uint8 *dirty = tiledirty + tile;
+  if(dirty[0] & 1) {
+    dirty[0] &= ~1;
     uint8 *output = (uint8*)tiledata[0] + (tile << 6);
     unsigned offset = tile << 4;
     unsigned y = 8;
@@ -30,8 +35,10 @@ uint8* PPU::Cache::tile_2bpp(unsigned tile) {
 }
 
 uint8* PPU::Cache::tile_4bpp(unsigned tile) {
-  if(tilevalid[1][tile] == 0) {
-    tilevalid[1][tile] = 1;
+  uint8 *dirty = tiledirty + (tile << 1);
+  if((dirty[0] | dirty[1]) & 2) {
+    dirty[0] &= ~2;
+    dirty[1] &= ~2;
     uint8 *output = (uint8*)tiledata[1] + (tile << 6);
     unsigned offset = tile << 5;
     unsigned y = 8;
@@ -63,8 +70,12 @@ uint8* PPU::Cache::tile_4bpp(unsigned tile) {
 }
 
 uint8* PPU::Cache::tile_8bpp(unsigned tile) {
-  if(tilevalid[2][tile] == 0) {
-    tilevalid[2][tile] = 1;
+  uint8 *dirty = tiledirty + (tile << 2);
+  if((dirty[0] | dirty[1] | dirty[2] | dirty[3]) & 4) {
+    dirty[0] &= ~4;
+    dirty[1] &= ~4;
+    dirty[2] &= ~4;
+    dirty[3] &= ~4;
     uint8 *output = (uint8*)tiledata[2] + (tile << 6);
     unsigned offset = tile << 6;
     unsigned y = 8;
@@ -116,9 +127,8 @@ PPU::Cache::Cache(PPU &self) : self(self) {
   tiledata[0] = new uint8[262144]();
   tiledata[1] = new uint8[131072]();
   tiledata[2] = new uint8[ 65536]();
-  tilevalid[0] = new uint8[ 4096]();
-  tilevalid[1] = new uint8[ 2048]();
-  tilevalid[2] = new uint8[ 1024]();
+  tiledirty = new uint8[4096];
+  memset(tiledirty, 7, 4096);
 }
 
 #endif
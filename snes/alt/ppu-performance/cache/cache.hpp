@@ -1,7 +1,9 @@
 struct Cache {
 public:
   uint8 *tiledata[3];
-  uint8 *tilevalid[3];
+  uint8 *tiledirty;  //one byte per 16-byte VRAM granule: bit n set = tiledata[n] is stale there
+
+  alwaysinline void invalidate(unsigned addr) { tiledirty[addr >> 4] = 7; }
 
   uint8* tile_2bpp(unsigned tile);
   uint8* tile_4bpp(unsigned tile);
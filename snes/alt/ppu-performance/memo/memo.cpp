@@ -0,0 +1,165 @@
+#ifdef PPU_CPP
+
+//each frame buffer line is kept together with a fingerprint of everything it was rendered
+//from. when a line's fingerprint matches the one from the previous frame, the stored output
+//is copied back instead of running the background, sprite and screen stages again.
+//registers, CGRAM and the sprites on the line are compared by value. VRAM is compared by
+//reference: the renderers mark the 16-byte granules the line reads (tilemap entries and
+//tiles), and the line is reused only if none of those granules has changed since. the tiles
+//a line reads are chosen by its registers and tilemap entries, so unchanged inputs imply the
+//same granule set; a VRAM write elsewhere no longer invalidates the line.
+//a line that keeps missing (scrolling, HDMA effects) stops being captured for a few frames,
+//so screens that change every frame do not pay for the lookup on every line.
+
+void PPU::Memo::capture(Key &key) {
+  memset(&key, 0, sizeof(Key));
+
+  key.line = self.vcounter();
+  key.field = (self.display.interlace || self.regs.interlace) ? self.field() : 0;
+
+  unsigned *regs = key.regs;
+  *regs++ = self.regs.display_brightness;
+  *regs++ = self.regs.bgmode;
+  *regs++ = self.regs.bg3_priority;
+  *regs++ = self.regs.mode7_hoffset;
+  *regs++ = self.regs.mode7_voffset;
+  *regs++ = self.regs.mode7_repeat;
+  *regs++ = self.regs.mode7_vflip;
+  *regs++ = self.regs.mode7_hflip;
+  *regs++ = self.regs.m7a;
+  *regs++ = self.regs.m7b;
+  *regs++ = self.regs.m7c;
+  *regs++ = self.regs.m7d;
+  *regs++ = self.regs.m7x;
+  *regs++ = self.regs.m7y;
+  *regs++ = self.regs.window_one_left;
+  *regs++ = self.regs.window_one_right;
+  *regs++ = self.regs.window_two_left;
+  *regs++ = self.regs.window_two_right;
+  *regs++ = self.regs.mode7_extbg;
+  *regs++ = self.regs.pseudo_hires;
+  *regs++ = self.regs.overscan;
+  *regs++ = self.regs.interlace;
+
+  Background *bg[4] = { &self.bg1, &self.bg2, &self.bg3, &self.bg4 };
+  for(unsigned n = 0; n < 4; n++) {
+    key.bg[n] = bg[n]->regs;
+    key.bg_mosaic_voffset[n] = bg[n]->mosaic_voffset;
+    key.bg_enable[n][0] = bg[n]->priority0_enable;
+    key.bg_enable[n][1] = bg[n]->priority1_enable;
+    memcpy(key.bg_window[n], &bg[n]->window, sizeof key.bg_window[n]);
+  }
+
+  self.sprite.validate_list();
+  for(unsigned i = 0; i < 128 && key.sprite_items < 33; i++) {
+    unsigned s = (self.sprite.regs.first_sprite + i) & 127;
+    if(self.sprite.on_scanline(s) == false) continue;
+    const Sprite::List &item = self.sprite.list[s];
+    key.sprite_item[key.sprite_items++] = (uint64)s << 0 | (uint64)item.x << 7 | (uint64)item.y << 16
+      | (uint64)item.character << 24 | (uint64)item.size << 32 | (uint64)item.use_nameselect << 33
+      | (uint64)item.vflip << 34 | (uint64)item.hflip << 35 | (uint64)item.palette << 36
+      | (uint64)item.priority << 39;
+  }
+
+  key.sprite = self.sprite.regs;
+  key.sprite.time_over = false;
+  key.sprite.range_over = false;
+  key.sprite_enable[0] = self.sprite.priority0_enable;
+  key.sprite_enable[1] = self.sprite.priority1_enable;
+  key.sprite_enable[2] = self.sprite.priority2_enable;
+  key.sprite_enable[3] = self.sprite.priority3_enable;
+  memcpy(key.sprite_window, &self.sprite.window, sizeof key.sprite_window);
+
+  key.screen = self.screen.regs;
+  memcpy(key.screen_window, &self.screen.window, sizeof key.screen_window);
+
+  memcpy(key.cgram, self.cgram, 512);
+}
+
+uint32* PPU::Memo::output() {
+  uint32 *data = self.output + self.vcounter() * 1024;
+  if(self.interlace() && self.field()) data += 512;
+  return data;
+}
+
+bool PPU::Memo::vram_unchanged(const Entry &entry) {
+  for(unsigned block = 0; block < 64; block++) {
+    uint64 bits = entry.vram_touched[block];
+    if(bits == 0 || vram_block[block] <= entry.vram_time) continue;
+    for(unsigned n = 0; n < 64; n++) {
+      if((bits >> n & 1) && vram_granule[block << 6 | n] > entry.vram_time) return false;
+    }
+  }
+  return true;
+}
+
+//returns true when the line was restored from the previous frame
+bool PPU::Memo::restore() {
+  active = &entry[self.vcounter() * 2 + (self.interlace() && self.field())];
+  if(active->skip) {
+    active->skip--;
+    active = 0;
+    touched = scratch;
+    return false;
+  }
+  capture(key);
+
+  if(active->valid) {
+    if(memcmp(&active->key, &key, sizeof(Key)) == 0 && vram_unchanged(*active)) {
+      memcpy(output(), active->output, active->width << 2);
+      self.sprite.regs.time_over |= active->time_over;
+      self.sprite.regs.range_over |= active->range_over;
+      active->misses = 0;
+      return true;
+    }
+    if(++active->misses >= 2) active->skip = min(active->misses, 8u) * 2;
+  }
+
+  touched = active->vram_touched;
+  memset(touched, 0, sizeof active->vram_touched);
+
+  //render this line's sprite flags in isolation, so they can be stored with it
+  time_over = self.sprite.regs.time_over;
+  range_over = self.sprite.regs.range_over;
+  self.sprite.regs.time_over = false;
+  self.sprite.regs.range_over = false;
+  return false;
+}
+
+void PPU::Memo::store() {
+  if(active == 0) return;
+  active->valid = true;
+  active->time_over = self.sprite.regs.time_over;
+  active->range_over = self.sprite.regs.range_over;
+  active->width = self.display.width;
+  active->vram_time = vram_time;
+  active->key = key;
+  memcpy(active->output, output(), active->width << 2);
+
+  self.sprite.regs.time_over |= time_over;
+  self.sprite.regs.range_over |= range_over;
+}
+
+void PPU::Memo::invalidate() {
+  for(unsigned n = 0; n < 480; n++) {
+    entry[n].valid = false;
+    entry[n].misses = 0;
+    entry[n].skip = 0;
+  }
+}
+
+PPU::Memo::Memo(PPU &self) : self(self) {
+  entry = new Entry[480];
+  active = 0;
+  touched = scratch;
+  vram_time = 0;
+  memset(vram_granule, 0, sizeof vram_granule);
+  memset(vram_block, 0, sizeof vram_block);
+  invalidate();
+}
+
+PPU::Memo::~Memo() {
+  delete[] entry;
+}
+
+#endif
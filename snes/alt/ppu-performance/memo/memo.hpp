@@ -0,0 +1,77 @@
+struct Memo {
+public:
+  //everything a scanline's output depends on, besides the VRAM it reads
+  struct Key {
+    unsigned line;
+    unsigned field;
+    unsigned sprite_items;
+    uint64 sprite_item[33];  //sprites on this line in evaluation order; only the first 33 are looked at
+    unsigned regs[22];
+
+    Background::Regs bg[4];
+    unsigned bg_mosaic_voffset[4];
+    bool bg_enable[4][2];
+    uint8 bg_window[4][offsetof(LayerWindow, main)];
+
+    Sprite::Regs sprite;
+    bool sprite_enable[4];
+    uint8 sprite_window[offsetof(LayerWindow, main)];
+
+    Screen::Regs screen;
+    uint8 screen_window[offsetof(ColorWindow, main)];
+
+    uint8 cgram[512];
+  };
+
+  struct Entry {
+    bool valid;
+    bool time_over;
+    bool range_over;
+    unsigned width;
+    unsigned misses;          //consecutive frames the stored line could not be reused
+    unsigned skip;            //frames left before the line is looked up again
+    uint64 vram_time;         //vram_time when the line was rendered
+    uint64 vram_touched[64];  //bit n set = the line read from VRAM granule n (16 bytes)
+    Key key;
+    uint32 output[512];
+  };
+
+  uint64 vram_time;           //bumped on every VRAM write that changes a byte
+  uint64 vram_granule[4096];  //vram_time of the last change to each granule
+  uint64 vram_block[64];      //latest of the above for each run of 64 granules
+
+  alwaysinline void vram_written(unsigned addr) {
+    vram_block[addr >> 10] = vram_granule[addr >> 4] = ++vram_time;
+  }
+
+  //called by the renderers for every VRAM range the line being rendered reads
+  alwaysinline void touch(unsigned addr, unsigned length) {
+    for(unsigned n = addr >> 4, last = (addr + length - 1) >> 4; n <= last; n++) {
+      touched[n >> 6] |= (uint64)1 << (n & 63);
+    }
+  }
+
+  bool restore();
+  void store();
+  void invalidate();
+
+  void serialize(serializer&);
+  Memo(PPU &self);
+  ~Memo();
+
+private:
+  Entry *entry;
+  Entry *active;
+  uint64 *touched;
+  uint64 scratch[64];
+  Key key;
+  bool time_over;
+  bool range_over;
+
+  void capture(Key &key);
+  bool vram_unchanged(const Entry &entry);
+  uint32* output();
+
+  PPU &self;
+  friend class PPU;
+};
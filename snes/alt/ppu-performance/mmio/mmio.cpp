@@ -29,10 +29,10 @@ uint8 PPU::vram_read(unsigned addr) {
 
 void PPU::vram_write(unsigned addr, uint8 data) {
   if(regs.display_disable || cpu.vcounter() >= display.height) {
+    if(vram[addr] == data) return;
     vram[addr] = data;
-    cache.tilevalid[0][addr >> 4] = false;
-    cache.tilevalid[1][addr >> 5] = false;
-    cache.tilevalid[2][addr >> 6] = false;
+    cache.invalidate(addr);
+    memo.vram_written(addr);
     return;
   }
 }
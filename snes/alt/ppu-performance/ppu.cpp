@@ -17,6 +17,7 @@ namespace SNES {
 #include "background/background.cpp"
 #include "sprite/sprite.cpp"
 #include "screen/screen.cpp"
+#include "memo/memo.cpp"
 #include "serialization.cpp"
 
 void PPU::step(unsigned clocks) {
@@ -63,6 +64,7 @@ void PPU::render_scanline() {
   bg3.scanline();
   bg4.scanline();
   if(regs.display_disable) return screen.render_black();
+  if(memo.restore()) return;
   screen.scanline();
   bg1.render();
   bg2.render();
@@ -70,6 +72,7 @@ void PPU::render_scanline() {
   bg4.render();
   sprite.render();
   screen.render();
+  memo.store();
 }
 
 void PPU::scanline() {
@@ -103,10 +106,11 @@ void PPU::power() {
 }
 
 void PPU::reset() {
-  create(Enter, system.cpu_frequency);
+  create(Enter, system.cpu_frequency, ShallowStack);
   PPUcounter::reset();
   memset(surface, 0, 512 * 512 * sizeof(uint32));
   mmio_reset();
+  memo.invalidate();
   display.interlace = false;
   display.overscan = false;
 }
@@ -140,7 +144,8 @@ bg2(*this, Background::ID::BG2),
 bg3(*this, Background::ID::BG3),
 bg4(*this, Background::ID::BG4),
 sprite(*this),
-screen(*this) {
+screen(*this),
+memo(*this) {
   surface = new uint32[512 * 512];
   output = surface + 16 * 512;
   display.width = 256;
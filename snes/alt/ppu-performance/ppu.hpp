@@ -42,6 +42,7 @@ private:
   #include "background/background.hpp"
   #include "sprite/sprite.hpp"
   #include "screen/screen.hpp"
+  #include "memo/memo.hpp"
 
   Cache cache;
   Background bg1;
@@ -50,6 +51,7 @@ private:
   Background bg4;
   Sprite sprite;
   Screen screen;
+  Memo memo;
 
   struct Display {
     bool interlace;
@@ -68,6 +70,7 @@ private:
   friend class PPU::Background;
   friend class PPU::Sprite;
   friend class PPU::Screen;
+  friend class PPU::Memo;
   friend class Video;
 };
 
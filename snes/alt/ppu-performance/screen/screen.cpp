@@ -15,26 +15,6 @@ unsigned PPU::Screen::get_direct_color(unsigned p, unsigned t) {
          ((t >> 6) << 13) | ((p >> 2) << 12);
 }
 
-uint16 PPU::Screen::addsub(unsigned x, unsigned y, bool halve) {
-  if(!regs.color_mode) {
-    if(!halve) {
-      unsigned sum = x + y;
-      unsigned carry = (sum - ((x ^ y) & 0x0421)) & 0x8420;
-      return (sum - carry) | (carry - (carry >> 5));
-    } else {
-      return (x + y - ((x ^ y) & 0x0421)) >> 1;
-    }
-  } else {
-    unsigned diff = x - y + 0x8420;
-    unsigned borrow = (diff - ((x ^ y) & 0x8420)) & 0x8420;
-    if(!halve) {
-      return (diff - borrow) & (borrow - (borrow >> 5));
-    } else {
-      return (((diff - borrow) & (borrow - (borrow >> 5))) & 0x7bde) >> 1;
-    }
-  }
-}
-
 void PPU::Screen::scanline() {
   unsigned main_color = get_palette(0);
   unsigned sub_color = (self.regs.pseudo_hires == false && self.regs.bgmode != 5 && self.regs.bgmode != 6)
@@ -60,72 +40,75 @@ void PPU::Screen::render_black() {
   memset(data, 0, self.display.width << 2);
 }
 
-uint16 PPU::Screen::get_pixel_main(unsigned x) {
-  Output::Pixel main = output.main[x];
-  Output::Pixel sub = output.sub[x];
-
-  if(!regs.addsub_mode) {
-    sub.source = 6;
-    sub.color = regs.color;
-  }
-
-  if(!window.main[x]) {
-    if(!window.sub[x]) {
-      return 0x0000;
-    }
-    main.color = 0x0000;
-  }
-
-  if(main.source != 5 && regs.color_enable[main.source] && window.sub[x]) {
-    bool halve = false;
-    if(regs.color_halve && window.main[x]) {
-      if(!regs.addsub_mode || sub.source != 6) halve = true;
-    }
-    return addsub(main.color, sub.color, halve);
+//blends one line of the screen in front with the screen (or fixed color) behind it.
+//everything that is constant for the scanline is resolved before the loop, and the
+//loop itself is branch-free, so that the compiler can vectorize it on any target.
+template<bool subtract>
+void PPU::Screen::compose(uint16 *line, const Output::Pixel *above, const Output::Pixel *below) {
+  //sprites using palettes 0-3 (source 5) never participate in color math
+  unsigned math[7];
+  for(unsigned source = 0; source < 7; source++) {
+    math[source] = (source != 5 && regs.color_enable[source]) ? ~0u : 0u;
   }
+  unsigned addsub_mode = regs.addsub_mode ? ~0u : 0u;
+  unsigned fixed_color = regs.color;
+  unsigned halve_mask = regs.color_halve ? ~0u : 0u;
 
-  return main.color;
-}
-
-uint16 PPU::Screen::get_pixel_sub(unsigned x) {
-  Output::Pixel main = output.sub[x];
-  Output::Pixel sub = output.main[x];
-
-  if(!regs.addsub_mode) {
-    sub.source = 6;
-    sub.color = regs.color;
-  }
-
-  if(!window.main[x]) {
-    if(!window.sub[x]) {
-      return 0x0000;
+  for(unsigned x = 0; x < 256; x++) {
+    unsigned wmain = -(unsigned)window.main[x];
+    unsigned wsub = -(unsigned)window.sub[x];
+
+    unsigned a = above[x].color & wmain;
+    unsigned b = (below[x].color & addsub_mode) | (fixed_color & ~addsub_mode);
+    unsigned source = above[x].source;
+    unsigned blend = wsub & (
+      (math[0] & -(unsigned)(source == 0)) | (math[1] & -(unsigned)(source == 1))
+    | (math[2] & -(unsigned)(source == 2)) | (math[3] & -(unsigned)(source == 3))
+    | (math[4] & -(unsigned)(source == 4)) | (math[6] & -(unsigned)(source == 6))
+    );
+    unsigned halve = halve_mask & wmain & (-(unsigned)(below[x].source != 6) | ~addsub_mode);
+
+    unsigned full, half;
+    if(!subtract) {
+      unsigned sum = a + b;
+      unsigned lsb = (a ^ b) & 0x0421;
+      unsigned carry = (sum - lsb) & 0x8420;
+      full = (sum - carry) | (carry - (carry >> 5));
+      half = (sum - lsb) >> 1;
+    } else {
+      unsigned diff = a - b + 0x8420;
+      unsigned borrow = (diff - ((a ^ b) & 0x8420)) & 0x8420;
+      full = (diff - borrow) & (borrow - (borrow >> 5));
+      half = (full & 0x7bde) >> 1;
     }
-    main.color = 0x0000;
-  }
 
-  if(main.source != 5 && regs.color_enable[main.source] && window.sub[x]) {
-    bool halve = false;
-    if(regs.color_halve && window.main[x]) {
-      if(!regs.addsub_mode || sub.source != 6) halve = true;
-    }
-    return addsub(main.color, sub.color, halve);
+    unsigned color = (full & ~halve) | (half & halve);
+    line[x] = ((color & blend) | (a & ~blend)) & (wmain | wsub);
   }
-
-  return main.color;
 }
 
 void PPU::Screen::render() {
   uint32 *data = self.output + self.vcounter() * 1024;
   if(self.interlace() && self.field()) data += 512;
+  unsigned brightness = self.regs.display_brightness << 15;
+  uint16 line[256];
 
   if(!self.regs.pseudo_hires && self.regs.bgmode != 5 && self.regs.bgmode != 6) {
-    for(unsigned i = 0; i < 256; i++) {
-      data[i] = (self.regs.display_brightness << 15) | get_pixel_main(i);
-    }
+    if(!regs.color_mode) compose<false>(line, output.main, output.sub);
+    else compose<true>(line, output.main, output.sub);
+    for(unsigned i = 0; i < 256; i++) data[i] = brightness | line[i];
   } else {
+    uint16 line_sub[256];
+    if(!regs.color_mode) {
+      compose<false>(line_sub, output.sub, output.main);
+      compose<false>(line, output.main, output.sub);
+    } else {
+      compose<true>(line_sub, output.sub, output.main);
+      compose<true>(line, output.main, output.sub);
+    }
     for(unsigned i = 0; i < 256; i++) {
-      *data++ = (self.regs.display_brightness << 15) | get_pixel_sub(i);
-      *data++ = (self.regs.display_brightness << 15) | get_pixel_main(i);
+      *data++ = brightness | line_sub[i];
+      *data++ = brightness | line[i];
     }
   }
 }
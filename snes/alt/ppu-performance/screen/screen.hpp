@@ -15,9 +15,9 @@ struct Screen {
 
   struct Output {
     struct Pixel {
-      unsigned color;
-      unsigned priority;
-      unsigned source;
+      uint16 color;
+      uint8 priority;
+      uint8 source;
     } main[256], sub[256];
 
     alwaysinline void plot_main(unsigned x, unsigned color, unsigned priority, unsigned source);
@@ -28,11 +28,9 @@ struct Screen {
 
   alwaysinline unsigned get_palette(unsigned color);
   unsigned get_direct_color(unsigned palette, unsigned tile);
-  alwaysinline uint16 addsub(unsigned x, unsigned y, bool halve);
   void scanline();
   void render_black();
-  alwaysinline uint16 get_pixel_main(unsigned x);
-  alwaysinline uint16 get_pixel_sub(unsigned x);
+  template<bool subtract> void compose(uint16 *line, const Output::Pixel *above, const Output::Pixel *below);
   void render();
 
   void serialize(serializer&);
@@ -27,6 +27,7 @@ void PPU::serialize(serializer &s) {
   bg4.serialize(s);
   sprite.serialize(s);
   screen.serialize(s);
+  memo.serialize(s);
 
   s.integer(display.interlace);
   s.integer(display.overscan);
@@ -96,9 +97,12 @@ void PPU::serialize(serializer &s) {
 
 void PPU::Cache::serialize(serializer &s) {
   //rather than save ~512KB worth of cached tiledata, invalidate it all
-  for(unsigned i = 0; i < 4096; i++) tilevalid[0][i] = false;
-  for(unsigned i = 0; i < 2048; i++) tilevalid[1][i] = false;
-  for(unsigned i = 0; i < 1024; i++) tilevalid[2][i] = false;
+  memset(tiledirty, 7, 4096);
+}
+
+void PPU::Memo::serialize(serializer &s) {
+  //VRAM and OAM are replaced without going through the epochs: start over
+  invalidate();
 }
 
 void PPU::Background::serialize(serializer &s) {
@@ -229,6 +233,7 @@ void PPU::LayerWindow::serialize(serializer &s) {
 
   s.array(main);
   s.array(sub);
+  main_state = sub_state = ~0ull;  //masks may have been replaced
 }
 
 void PPU::ColorWindow::serialize(serializer &s) {
@@ -244,6 +249,7 @@ void PPU::ColorWindow::serialize(serializer &s) {
 
   s.array(main);
   s.array(sub);
+  main_state = sub_state = ~0ull;  //masks may have been replaced
 }
 
 #endif
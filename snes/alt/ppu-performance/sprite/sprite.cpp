@@ -51,7 +51,7 @@ bool PPU::Sprite::on_scanline(unsigned sprite) {
   return false;
 }
 
-void PPU::Sprite::render() {
+void PPU::Sprite::validate_list() {
   if(list_valid == false) {
     list_valid = true;
     for(unsigned i = 0; i < 128; i++) {
@@ -69,6 +69,10 @@ void PPU::Sprite::render() {
       }
     }
   }
+}
+
+void PPU::Sprite::render() {
+  validate_list();
 
   unsigned itemcount = 0;
   unsigned tilecount = 0;
@@ -143,6 +147,7 @@ void PPU::Sprite::render() {
     if(tilelist[i].tile == 0xffff) continue;
 
     TileList &t = tilelist[i];
+    self.memo.touch(t.tile << 5, 32);
     uint8 *tiledata = self.cache.tile_4bpp(t.tile);
     tiledata += (t.y & 7) << 3;
     unsigned sx = t.x;
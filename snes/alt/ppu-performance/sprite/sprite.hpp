@@ -60,6 +60,7 @@ struct Sprite {
   void update_list(unsigned addr, uint8 data);
   void address_reset();
   void set_first();
+  void validate_list();
   alwaysinline bool on_scanline(unsigned sprite);
   void render();
 
@@ -1,19 +1,46 @@
 #ifdef PPU_CPP
 
+//masks are rebuilt only when a register they depend on changes; window registers
+//are rarely touched mid-frame, so most lines reuse the previous line's masks.
+//state packs the window positions (bits 0-31) and the per-layer settings above them.
+uint64 PPU::window_state(unsigned settings) {
+  return (uint64)settings << 32
+       | (unsigned)ppu.regs.window_one_left << 0 | (unsigned)ppu.regs.window_one_right << 8
+       | (unsigned)ppu.regs.window_two_left << 16 | (unsigned)ppu.regs.window_two_right << 24;
+}
+
+void PPU::window_fill(uint8 *output, unsigned left, unsigned right, uint8 set, uint8 clr) {
+  memset(output, clr, 256);
+  if(left <= right) memset(output + left, set, right - left + 1);
+}
+
+//window one and two coverage, each already xor'd with its invert flag
+void PPU::window_spans(uint8 *one, uint8 *two, bool one_invert, bool two_invert) {
+  window_fill(one, ppu.regs.window_one_left, ppu.regs.window_one_right, !one_invert, one_invert);
+  window_fill(two, ppu.regs.window_two_left, ppu.regs.window_two_right, !two_invert, two_invert);
+}
+
+void PPU::window_combine(uint8 *output, const uint8 *one, const uint8 *two, unsigned mask, uint8 clr) {
+  switch(mask) {
+    case 0: for(unsigned x = 0; x < 256; x++) output[x] = (one[x] | two[x]) ^ clr; break;
+    case 1: for(unsigned x = 0; x < 256; x++) output[x] = (one[x] & two[x]) ^ clr; break;
+    case 2: for(unsigned x = 0; x < 256; x++) output[x] = (one[x] ^ two[x]) ^ clr; break;
+    case 3: for(unsigned x = 0; x < 256; x++) output[x] = (one[x] ^ two[x] ^ 1) ^ clr; break;
+  }
+}
+
 void PPU::LayerWindow::render(bool screen) {
-  uint8 *output;
-  if(screen == 0) {
-    output = main;
-    if(main_enable == false) {
-      memset(output, 0, 256);
-      return;
-    }
-  } else {
-    output = sub;
-    if(sub_enable == false) {
-      memset(output, 0, 256);
-      return;
-    }
+  uint8 *output = (screen == 0 ? main : sub);
+  bool enable = (screen == 0 ? main_enable : sub_enable);
+
+  uint64 state = window_state(enable << 6 | mask << 4 | two_invert << 3 | two_enable << 2 | one_invert << 1 | one_enable << 0);
+  uint64 &cached = (screen == 0 ? main_state : sub_state);
+  if(cached == state) return;
+  cached = state;
+
+  if(enable == false) {
+    memset(output, 0, 256);
+    return;
   }
 
   if(one_enable == false && two_enable == false) {
@@ -23,39 +50,36 @@ void PPU::LayerWindow::render(bool screen) {
 
   if(one_enable == true && two_enable == false) {
     bool set = 1 ^ one_invert, clr = !set;
-    for(unsigned x = 0; x < 256; x++) {
-      output[x] = (x >= ppu.regs.window_one_left && x <= ppu.regs.window_one_right) ? set : clr;
-    }
-    return;
+    return window_fill(output, ppu.regs.window_one_left, ppu.regs.window_one_right, set, clr);
   }
 
   if(one_enable == false && two_enable == true) {
     bool set = 1 ^ two_invert, clr = !set;
-    for(unsigned x = 0; x < 256; x++) {
-      output[x] = (x >= ppu.regs.window_two_left && x <= ppu.regs.window_two_right) ? set : clr;
-    }
-    return;
+    return window_fill(output, ppu.regs.window_two_left, ppu.regs.window_two_right, set, clr);
   }
 
-  for(unsigned x = 0; x < 256; x++) {
-    bool one_mask = (x >= ppu.regs.window_one_left && x <= ppu.regs.window_one_right) ^ one_invert;
-    bool two_mask = (x >= ppu.regs.window_two_left && x <= ppu.regs.window_two_right) ^ two_invert;
-    switch(mask) {
-      case 0: output[x] = one_mask | (two_mask == 1); break;
-      case 1: output[x] = one_mask & (two_mask == 1); break;
-      case 2: output[x] = one_mask ^ (two_mask == 1); break;
-      case 3: output[x] = one_mask ^ (two_mask == 0); break;
-    }
-  }
+  uint8 one[256], two[256];
+  window_spans(one, two, one_invert, two_invert);
+  window_combine(output, one, two, mask, 0);
+}
+
+PPU::LayerWindow::LayerWindow() : main_state(~0ull), sub_state(~0ull) {
 }
 
 //
 
 void PPU::ColorWindow::render(bool screen) {
   uint8 *output = (screen == 0 ? main : sub);
+  unsigned screen_mask = (screen == 0 ? main_mask : sub_mask);
+
+  uint64 state = window_state(screen_mask << 6 | mask << 4 | two_invert << 3 | two_enable << 2 | one_invert << 1 | one_enable << 0);
+  uint64 &cached = (screen == 0 ? main_state : sub_state);
+  if(cached == state) return;
+  cached = state;
+
   bool set = 1, clr = 0;
 
-  switch(screen == 0 ? main_mask : sub_mask) {
+  switch(screen_mask) {
     case 0: memset(output, 1, 256); return;  //always
     case 1: set = 1, clr = 0; break;         //inside window only
     case 2: set = 0, clr = 1; break;         //outside window only
@@ -69,30 +93,20 @@ void PPU::ColorWindow::render(bool screen) {
 
   if(one_enable == true && two_enable == false) {
     if(one_invert) { set ^= 1; clr ^= 1; }
-    for(unsigned x = 0; x < 256; x++) {
-      output[x] = (x >= ppu.regs.window_one_left && x <= ppu.regs.window_one_right) ? set : clr;
-    }
-    return;
+    return window_fill(output, ppu.regs.window_one_left, ppu.regs.window_one_right, set, clr);
   }
 
   if(one_enable == false && two_enable == true) {
     if(two_invert) { set ^= 1; clr ^= 1; }
-    for(unsigned x = 0; x < 256; x++) {
-      output[x] = (x >= ppu.regs.window_two_left && x <= ppu.regs.window_two_right) ? set : clr;
-    }
-    return;
+    return window_fill(output, ppu.regs.window_two_left, ppu.regs.window_two_right, set, clr);
   }
 
-  for(unsigned x = 0; x < 256; x++) {
-    bool one_mask = (x >= ppu.regs.window_one_left && x <= ppu.regs.window_one_right) ^ one_invert;
-    bool two_mask = (x >= ppu.regs.window_two_left && x <= ppu.regs.window_two_right) ^ two_invert;
-    switch(mask) {
-      case 0: output[x] = one_mask | (two_mask == 1) ? set : clr; break;
-      case 1: output[x] = one_mask & (two_mask == 1) ? set : clr; break;
-      case 2: output[x] = one_mask ^ (two_mask == 1) ? set : clr; break;
-      case 3: output[x] = one_mask ^ (two_mask == 0) ? set : clr; break;
-    }
-  }
+  uint8 one[256], two[256];
+  window_spans(one, two, one_invert, two_invert);
+  window_combine(output, one, two, mask, clr);
+}
+
+PPU::ColorWindow::ColorWindow() : main_state(~0ull), sub_state(~0ull) {
 }
 
 #endif
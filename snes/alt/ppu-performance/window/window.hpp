@@ -11,9 +11,12 @@ struct LayerWindow {
 
   uint8 main[256];
   uint8 sub[256];
+  uint64 main_state;
+  uint64 sub_state;
 
   void render(bool screen);
   void serialize(serializer&);
+  LayerWindow();
 };
 
 struct ColorWindow {
@@ -29,7 +32,15 @@ struct ColorWindow {
 
   uint8 main[256];
   uint8 sub[256];
+  uint64 main_state;
+  uint64 sub_state;
 
   void render(bool screen);
   void serialize(serializer&);
+  ColorWindow();
 };
+
+static uint64 window_state(unsigned settings);
+static void window_fill(uint8 *output, unsigned left, unsigned right, uint8 set, uint8 clr);
+static void window_spans(uint8 *one, uint8 *two, bool one_invert, bool two_invert);
+static void window_combine(uint8 *output, const uint8 *one, const uint8 *two, unsigned mask, uint8 clr);
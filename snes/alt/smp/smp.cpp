@@ -19,6 +19,10 @@ namespace SNES {
 #include "memory.cpp"
 #include "timing.cpp"
 
+#if defined(THREADED_APU)
+  #include "worker.cpp"
+#endif
+
 void SMP::synchronize_cpu() {
   if(CPU::Threaded == true) {
   //if(clock >= 0 && scheduler.sync != Scheduler::SynchronizeMode::All) co_switch(cpu.thread);
@@ -54,6 +58,10 @@ void SMP::power() {
 
   cycle_step_cpu = 24 * cpu.frequency;
 
+  #if defined(THREADED_APU)
+  worker.start();
+  #endif
+
   reset();
 }
 
@@ -88,6 +96,9 @@ void SMP::reset() {
 }
 
 void SMP::serialize(serializer &s) {
+  #if defined(THREADED_APU)
+  worker.synchronize();
+  #endif
   Processor::serialize(s);
 
   s.array(apuram, 64 * 1024);
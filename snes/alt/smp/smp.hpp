@@ -21,6 +21,52 @@ public:
   SMP();
   ~SMP();
 
+#if defined(THREADED_APU)
+  //runs the SMP and DSP on a helper OS thread; see worker.cpp
+  struct Worker {
+    unsigned clocks;  //CPU clocks not yet handed to the worker
+
+    void flush();
+    void synchronize();
+    void port_write(unsigned port, unsigned data);
+    void sample(int16 left, int16 right);
+
+    void start();
+    void stop();
+    Worker();
+    ~Worker();
+
+  private:
+    enum { Run, PortWrite };
+    enum { CommandSize = 4096, SampleSize = 16384, SpinCount = 4096 };
+    struct Command { unsigned type, data; };
+
+    bool threaded;              //false on single-processor hosts: the SMP runs inline
+    nall::thread thread;
+    mutex lock;
+    condition work;             //worker sleeps here when the queue is empty
+    condition done;             //CPU sleeps here waiting for the worker
+    volatile unsigned quit;
+    volatile unsigned idle;     //worker is asleep, or about to be
+    volatile unsigned waiting;  //CPU is asleep, or about to be
+
+    //single-producer, single-consumer rings; counters run freely and wrap
+    Command command[CommandSize];
+    volatile unsigned pushed;     //commands written by the CPU
+    volatile unsigned completed;  //commands executed by the worker
+    uint32 output[SampleSize];
+    volatile unsigned produced;   //samples written by the worker
+    volatile unsigned consumed;   //samples played by the CPU
+
+    void push(unsigned type, unsigned data);
+    void wait(unsigned target);
+    void play();
+    void halt();
+    void main();
+    static void entry(void*);
+  } worker;
+#endif
+
 //private:
   struct Flags {
     bool n, v, p, b, h, i, z, c;
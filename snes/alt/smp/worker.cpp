@@ -0,0 +1,168 @@
+#ifdef SMP_CPP
+
+//The S-SMP only sees the S-CPU through the four CPUIO ports, so it never has
+//to run ahead of the CPU. Every CPU port write is queued behind the SMP time
+//that preceded it, and the worker thread replays the queue in order; a CPU
+//read of $2140-2143 is the only point that has to wait for the worker to
+//catch up. The SMP thus executes exactly the instructions it would execute
+//when driven inline from CPU::synchronize_smp(), so no rollback is needed.
+//DSP samples are collected on the worker and played back on the CPU thread.
+//
+//Commands and samples pass through single-producer, single-consumer rings, so
+//neither side takes a lock while the other is awake: the CPU publishes how far
+//it has pushed, the worker publishes how far it has completed, and a port read
+//spins on that progress counter briefly before sleeping. The mutex and the
+//conditions are only used to put an idle side to sleep and wake it again.
+//On a single-processor host the two threads could only take turns, so the
+//worker is not started and the SMP runs inline as in the default build.
+
+void SMP::Worker::entry(void *parameter) {
+  ((Worker*)parameter)->main();
+}
+
+void SMP::Worker::main() {
+  unsigned next = atomic_load(completed);
+  while(atomic_load(quit) == false) {
+    if(next == atomic_load(pushed)) {
+      for(unsigned n = 0; n < SpinCount && next == atomic_load(pushed); n++) spin_pause();
+      if(next != atomic_load(pushed)) continue;
+
+      lock.lock();
+      atomic_store(idle, 1);
+      while(next == atomic_load(pushed) && atomic_load(quit) == false) work.wait(lock);
+      atomic_store(idle, 0);
+      lock.unlock();
+      continue;
+    }
+
+    const Command &item = command[next & (CommandSize - 1)];
+    if(item.type == Run) {
+      smp.clock -= item.data * (uint64)smp.frequency;
+      smp.enter();
+    } else {
+      cpu.port_write(item.data >> 8, item.data);
+    }
+
+    atomic_store(completed, ++next);
+    if(atomic_load(waiting)) {
+      lock.lock();
+      done.broadcast();
+      lock.unlock();
+    }
+  }
+}
+
+void SMP::Worker::push(unsigned type, unsigned data) {
+  if(pushed - atomic_load(completed) == CommandSize) wait(pushed - CommandSize + 1);
+
+  Command &item = command[pushed & (CommandSize - 1)];
+  item.type = type;
+  item.data = data;
+  atomic_store(pushed, pushed + 1);
+
+  if(atomic_load(idle)) {
+    lock.lock();
+    work.signal();
+    lock.unlock();
+  }
+}
+
+//wait until the worker has completed command number target
+void SMP::Worker::wait(unsigned target) {
+  for(unsigned n = 0; n < SpinCount; n++) {
+    if((signed)(atomic_load(completed) - target) >= 0) return;
+    spin_pause();
+  }
+
+  lock.lock();
+  atomic_store(waiting, 1);
+  while((signed)(atomic_load(completed) - target) < 0) done.wait(lock);
+  atomic_store(waiting, 0);
+  lock.unlock();
+}
+
+void SMP::Worker::play() {
+  unsigned last = atomic_load(produced), next = consumed;
+  while(next != last) {
+    uint32 data = output[next++ & (SampleSize - 1)];
+    audio.sample((int16)(data >> 0), (int16)(data >> 16));
+  }
+  atomic_store(consumed, next);
+}
+
+//hand elapsed CPU time to the worker without waiting for it
+void SMP::Worker::flush() {
+  if(threaded == false) {
+    smp.clock -= clocks * (uint64)smp.frequency;
+    clocks = 0;
+    return smp.enter();
+  }
+
+  if(clocks) push(Run, clocks);
+  clocks = 0;
+  play();
+}
+
+//wait until the worker has consumed the queue; SMP state is then safe to access
+void SMP::Worker::synchronize() {
+  wait(pushed);
+  play();
+
+  smp.clock -= clocks * (uint64)smp.frequency;
+  clocks = 0;
+}
+
+void SMP::Worker::port_write(unsigned port, unsigned data) {
+  if(threaded == false) {
+    flush();
+    return cpu.port_write(port, data);
+  }
+
+  if(clocks) push(Run, clocks);
+  clocks = 0;
+  push(PortWrite, (port & 3) << 8 | (data & 0xff));
+}
+
+//called from the worker thread. the CPU plays samples back at least once per
+//scanline, and the command ring holds at most CommandSize scanlines of SMP time
+//(a few samples each), so the sample ring does not fill in practice.
+void SMP::Worker::sample(int16 left, int16 right) {
+  if(threaded == false) return audio.sample(left, right);
+  while(produced - atomic_load(consumed) == SampleSize) spin_pause();
+  output[produced & (SampleSize - 1)] = (uint16)left << 0 | (uint16)right << 16;
+  atomic_store(produced, produced + 1);
+}
+
+void SMP::Worker::start() {
+  clocks = 0;
+  if(thread.active()) return;
+  quit = idle = waiting = 0;
+  pushed = completed = produced = consumed = 0;
+  threaded = processors() > 1 && thread.create(entry, (void*)this);
+}
+
+void SMP::Worker::halt() {
+  lock.lock();
+  atomic_store(quit, 1);
+  work.signal();
+  lock.unlock();
+  thread.join();
+}
+
+void SMP::Worker::stop() {
+  if(thread.active() == false) return;
+  synchronize();
+  halt();
+  threaded = false;
+}
+
+SMP::Worker::Worker() : clocks(0), threaded(false), quit(0), idle(0), waiting(0), pushed(0), completed(0), produced(0), consumed(0) {
+}
+
+//unload may be skipped at process exit; a worker left running would otherwise
+//keep nall::thread's destructor waiting in join() forever
+SMP::Worker::~Worker() {
+  if(thread.active()) halt();
+}
+
+#endif
@@ -2,11 +2,13 @@
 
 #include <nall/crc32.hpp>
 #include <nall/sha256.hpp>
+#include <nall/sort.hpp>
 
 #define CARTRIDGE_CPP
 namespace SNES {
 
 #include "markup.cpp"
+#include "decompression.cpp"
 #include "serialization.cpp"
 
 Cartridge cartridge;
@@ -44,28 +46,44 @@ void Cartridge::load(Mode::e cartridge_mode, const char *markup) {
   rom.write_protect(true);
   ram.write_protect(false);
 
-  crc32 = crc32_calculate(rom.data(), rom.size());
-
-  switch(mode.i) {
-  case Mode::Normal:
-  case Mode::BsxSlotted:
-    sha256 = nall::sha256(rom.data(), rom.size());
-    break;
-  case Mode::Bsx:
-    sha256 = nall::sha256(bsxflash.memory.data(), bsxflash.memory.size());
-    break;
-  case Mode::SufamiTurbo:
-    sha256 = nall::sha256(sufamiturbo.slotA.rom.data(), sufamiturbo.slotA.rom.size());
-    break;
-  case Mode::SuperGameBoy:
-    sha256 = GameBoy::cartridge.sha256();
-    break;
-  }
+  //hashes are computed on first use; most sessions never request them
+  crc32_valid = false;
+  sha256_valid = false;
 
   system.load();
   loaded = true;
 }
 
+unsigned Cartridge::crc32() {
+  if(crc32_valid == false) {
+    crc32_value = crc32_calculate(rom.data(), rom.size());
+    crc32_valid = true;
+  }
+  return crc32_value;
+}
+
+string Cartridge::sha256() {
+  if(sha256_valid == false) {
+    switch(mode.i) {
+    case Mode::Normal:
+    case Mode::BsxSlotted:
+      sha256_value = nall::sha256(rom.data(), rom.size());
+      break;
+    case Mode::Bsx:
+      sha256_value = nall::sha256(bsxflash.memory.data(), bsxflash.memory.size());
+      break;
+    case Mode::SufamiTurbo:
+      sha256_value = nall::sha256(sufamiturbo.slotA.rom.data(), sufamiturbo.slotA.rom.size());
+      break;
+    case Mode::SuperGameBoy:
+      sha256_value = GameBoy::cartridge.sha256();
+      break;
+    }
+    sha256_valid = true;
+  }
+  return sha256_value;
+}
+
 void Cartridge::unload() {
   if(loaded == false) return;
 
@@ -78,6 +96,8 @@ void Cartridge::unload() {
 
 Cartridge::Cartridge() {
   loaded = false;
+  crc32_valid = false;
+  sha256_valid = false;
   unload();
 }
 
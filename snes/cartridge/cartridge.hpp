@@ -28,8 +28,6 @@ struct Cartridge : property<Cartridge> {
   MappedRAM ram;
 
   readonly<bool> loaded;
-  readonly<unsigned> crc32;
-  readonly<string> sha256;
 
   Mode mode;
   Region region;
@@ -71,6 +69,8 @@ struct Cartridge : property<Cartridge> {
     unsigned addrhi;
     unsigned offset;
     unsigned size;
+    unsigned id;  //reader/writer slot assigned by Bus::map_xml()
+    bool passive;  //plain cartridge ROM or RAM; see Bus::passive
 
     Mapping();
     Mapping(const function<uint8 (unsigned)>&, const function<void (unsigned, uint8)>&);
@@ -85,14 +85,54 @@ struct Cartridge : property<Cartridge> {
     } nss;
   } information;
 
+  //precomputed S-DD1 and SPC7110 decompressor output, from an image mapped by the frontend
+  struct Decompression {
+    bool tracing;  //collect live decoder output for save()
+
+    bool load(const uint8 *data, unsigned size, unsigned checksum);
+    void trace(unsigned checksum);
+    void unload();
+
+    const uint8* find(unsigned key, unsigned aux, unsigned &length) const;
+    void record(unsigned key, unsigned aux, const uint8 *data, unsigned length);
+    bool save(const char *filename);
+
+    Decompression();
+
+  private:
+    struct Entry {
+      unsigned key;
+      unsigned aux;
+      unsigned length;
+      unsigned offset;
+      bool operator<(const Entry &source) const {
+        return key < source.key || (key == source.key && aux < source.aux);
+      }
+    };
+
+    const uint8 *image;
+    unsigned count;
+    unsigned checksum;
+    linear_vector<Entry> traced;
+    linear_vector<uint8> traced_data;
+  } decompression;
+
   void load(Mode::e, const char*);
   void unload();
 
+  unsigned crc32();
+  string sha256();
+
   void serialize(serializer&);
   Cartridge();
   ~Cartridge();
 
 private:
+  bool crc32_valid;
+  bool sha256_valid;
+  unsigned crc32_value;
+  string sha256_value;
+
   void parse_markup(const char*);
   unsigned parse_markup_integer(string&);
   void parse_markup_map(Mapping&, XML::Node&);
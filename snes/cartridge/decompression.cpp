@@ -0,0 +1,118 @@
+#ifdef CARTRIDGE_CPP
+
+//image layout; every field is 32-bit little-endian:
+//  "BSDC", version (1), crc32 of the base ROM, entry count
+//  entry count * { key, aux, length, data offset }, sorted by key and then aux
+//  decompressed data
+//S-DD1 entries are keyed by DMA source address, with the four MMC bank registers in aux;
+//SPC7110 entries are keyed by data ROM offset, with the decompression mode in aux.
+
+static unsigned decompression_read32(const uint8 *data) {
+  return data[0] << 0 | data[1] << 8 | data[2] << 16 | data[3] << 24;
+}
+
+bool Cartridge::Decompression::load(const uint8 *data, unsigned size, unsigned checksum_) {
+  unload();
+  if(size < 16 || memcmp(data, "BSDC", 4) != 0) return false;
+  if(decompression_read32(data + 4) != 1 || decompression_read32(data + 8) != checksum_) return false;
+
+  unsigned entries = decompression_read32(data + 12);
+  if(entries > (size - 16) / 16) return false;
+  for(unsigned n = 0; n < entries; n++) {
+    unsigned length = decompression_read32(data + 16 + n * 16 +  8);
+    unsigned offset = decompression_read32(data + 16 + n * 16 + 12);
+    if(offset > size || length > size - offset) return false;
+  }
+
+  image = data;
+  count = entries;
+  checksum = checksum_;
+  return true;
+}
+
+void Cartridge::Decompression::trace(unsigned checksum_) {
+  unload();
+  tracing = true;
+  checksum = checksum_;
+}
+
+void Cartridge::Decompression::unload() {
+  tracing = false;
+  image = 0;
+  count = 0;
+  traced.reset();
+  traced_data.reset();
+}
+
+const uint8* Cartridge::Decompression::find(unsigned key, unsigned aux, unsigned &length) const {
+  unsigned lo = 0, hi = count;
+  while(lo < hi) {
+    unsigned mid = (lo + hi) >> 1;
+    const uint8 *entry = image + 16 + mid * 16;
+    unsigned entry_key = decompression_read32(entry + 0);
+    unsigned entry_aux = decompression_read32(entry + 4);
+    if(entry_key == key && entry_aux == aux) {
+      length = decompression_read32(entry + 8);
+      return image + decompression_read32(entry + 12);
+    }
+    if(entry_key < key || (entry_key == key && entry_aux < aux)) lo = mid + 1;
+    else hi = mid;
+  }
+  return 0;
+}
+
+//keep the longest output seen for each key
+void Cartridge::Decompression::record(unsigned key, unsigned aux, const uint8 *data, unsigned length) {
+  if(tracing == false || length == 0) return;
+
+  Entry *entry = 0;
+  for(unsigned n = 0; n < traced.size(); n++) {
+    if(traced[n].key != key || traced[n].aux != aux) continue;
+    if(traced[n].length >= length) return;
+    entry = &traced[n];
+    break;
+  }
+
+  unsigned offset = traced_data.size();
+  traced_data.resize(offset + length);
+  memcpy(&traced_data[offset], data, length);
+
+  if(entry) {
+    entry->length = length;
+    entry->offset = offset;
+  } else {
+    Entry e = { key, aux, length, offset };
+    traced.append(e);
+  }
+}
+
+bool Cartridge::Decompression::save(const char *filename) {
+  if(tracing == false || traced.size() == 0) return false;
+  sort(&traced[0], traced.size());
+
+  file fp;
+  if(fp.open(filename, file::mode_write) == false) return false;
+  fp.write((const uint8*)"BSDC", 4);
+  fp.writel(1, 4);
+  fp.writel(checksum, 4);
+  fp.writel(traced.size(), 4);
+
+  unsigned offset = 16 + traced.size() * 16;
+  for(unsigned n = 0; n < traced.size(); n++) {
+    fp.writel(traced[n].key, 4);
+    fp.writel(traced[n].aux, 4);
+    fp.writel(traced[n].length, 4);
+    fp.writel(offset, 4);
+    offset += traced[n].length;
+  }
+  for(unsigned n = 0; n < traced.size(); n++) {
+    fp.write(&traced_data[traced[n].offset], traced[n].length);
+  }
+  fp.close();
+  return true;
+}
+
+Cartridge::Decompression::Decompression() : tracing(false), image(0), count(0), checksum(0) {
+}
+
+#endif
@@ -77,6 +77,7 @@ void Cartridge::parse_markup_rom(XML::Node &root) {
   foreach(node, root) {
     if(node.name != "map") continue;
     Mapping m(rom);
+    m.passive = true;
     parse_markup_map(m, node);
     if(m.size == 0) m.size = rom.size();
     mapping.append(m);
@@ -88,6 +89,7 @@ void Cartridge::parse_markup_ram(XML::Node &root) {
   ram_size = parse_markup_integer(root["size"].data);
   foreach(node, root) {
     Mapping m(ram);
+    m.passive = true;
     parse_markup_map(m, node);
     if(m.size == 0) m.size = ram_size;
     mapping.append(m);
@@ -289,6 +291,8 @@ void Cartridge::parse_markup_hitachidsp(XML::Node &root) {
   has_hitachidsp = true;
 
   for(unsigned n = 0; n < 1024; n++) hitachidsp.dataROM[n] = 0x000000;
+  hitachidsp.rom_mappings.reset();
+  hitachidsp.dsp_mappings.reset();
 
   hitachidsp.frequency = parse_markup_integer(root["frequency"].data);
   if(hitachidsp.frequency == 0) hitachidsp.frequency = 20000000;
@@ -325,6 +329,7 @@ void Cartridge::parse_markup_hitachidsp(XML::Node &root) {
         if(leaf.name != "map") continue;
         Mapping m(READER( &HitachiDSP::rom_read, &hitachidsp ), WRITER( &HitachiDSP::rom_write, &hitachidsp ));
         parse_markup_map(m, leaf);
+        hitachidsp.rom_mappings.append(mapping.size());
         mapping.append(m);
       }
     }
@@ -332,6 +337,7 @@ void Cartridge::parse_markup_hitachidsp(XML::Node &root) {
       foreach(leaf, node) {
         Mapping m(READER( &HitachiDSP::dsp_read, &hitachidsp ), WRITER( &HitachiDSP::dsp_write, &hitachidsp ));
         parse_markup_map(m, leaf);
+        hitachidsp.dsp_mappings.append(mapping.size());
         mapping.append(m);
       }
     }
@@ -541,21 +547,24 @@ void Cartridge::parse_markup_link(XML::Node &root) {
 
 Cartridge::Mapping::Mapping() {
   mode.i = Bus::MapMode::Direct;
-  banklo = bankhi = addrlo = addrhi = offset = size = 0;
+  banklo = bankhi = addrlo = addrhi = offset = size = id = 0;
+  passive = false;
 }
 
 Cartridge::Mapping::Mapping(Memory &memory) {
   read = READER( &Memory::read, &memory );
   write = WRITER( &Memory::write, &memory );
   mode.i = Bus::MapMode::Direct;
-  banklo = bankhi = addrlo = addrhi = offset = size = 0;
+  banklo = bankhi = addrlo = addrhi = offset = size = id = 0;
+  passive = false;
 }
 
 Cartridge::Mapping::Mapping(const function<uint8 (unsigned)> &read_, const function<void (unsigned, uint8)> &write_) {
   read = read_;
   write = write_;
   mode.i = Bus::MapMode::Direct;
-  banklo = bankhi = addrlo = addrhi = offset = size = 0;
+  banklo = bankhi = addrlo = addrhi = offset = size = id = 0;
+  passive = false;
 }
 
 #endif
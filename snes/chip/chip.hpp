@@ -1,6 +1,15 @@
 struct Coprocessor : Processor {
+  bool asleep;
+
   alwaysinline void step(unsigned clocks);
   alwaysinline void synchronize_cpu();
+
+  inline void sleep();
+  inline void wake();
+  inline void catchup(unsigned clocks);
+  virtual void idle() { catchup(1); }
+
+  inline Coprocessor() : asleep(false) {}
 };
 
 #include <snes/chip/nss/nss.hpp>
@@ -26,3 +35,23 @@ void Coprocessor::step(unsigned clocks) {
 void Coprocessor::synchronize_cpu() {
   if(clock >= 0 && scheduler.sync.i != Scheduler::SynchronizeMode::All) co_switch(cpu.thread);
 }
+
+//park the thread until wake(): while asleep, CPU::synchronize_coprocessors() no longer
+//switches to it and calls idle() instead, which must account for the elapsed time in bulk
+void Coprocessor::sleep() {
+  asleep = true;
+  if(scheduler.sync.i == Scheduler::SynchronizeMode::All) return;
+  if(clock < 0) idle();
+  co_switch(cpu.thread);
+}
+
+//the thread resumes at the next synchronization, just as it would have from an idle loop
+void Coprocessor::wake() {
+  asleep = false;
+}
+
+//advance the clock as an idle loop of step(clocks) would have by the time it caught up
+void Coprocessor::catchup(unsigned clocks) {
+  int64 quantum = clocks * (int64)cpu.frequency;
+  if(clock < 0) clock += (quantum - 1 - clock) / quantum * quantum;
+}
@@ -19,13 +19,12 @@ void HitachiDSP::enter() {
 
     switch(state.i) {
     case State::Idle:
-      step(1);
-      break;
+      //only an S-CPU write to $1f47 or $1f4f can end the idle state
+      sleep();
+      continue;
     case State::DMA:
-      for(unsigned n = 0; n < regs.dma_length; n++) {
-        bus.write(regs.dma_target + n, bus.read(regs.dma_source + n));
-        step(2);
-      }
+      dma_transfer();
+      step(2 * regs.dma_length);
       state.i = State::Idle;
       break;
     case State::Execute:
@@ -46,6 +45,9 @@ void HitachiDSP::init() {
 }
 
 void HitachiDSP::load() {
+  memset(bus_owner, BusOwner::None, sizeof bus_owner);
+  foreach(n, rom_mappings) bus_owner[cartridge.mapping[n].id] = BusOwner::ROM;
+  foreach(n, dsp_mappings) bus_owner[cartridge.mapping[n].id] = BusOwner::DSP;
 }
 
 void HitachiDSP::unload() {
@@ -55,7 +57,8 @@ void HitachiDSP::power() {
 }
 
 void HitachiDSP::reset() {
-  create(HitachiDSP::Enter, frequency);
+  create(HitachiDSP::Enter, frequency, ShallowStack);
+  asleep = false;
   state.i = State::Idle;
 
   regs.n = 0;
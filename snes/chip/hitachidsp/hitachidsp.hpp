@@ -12,6 +12,13 @@ public:
   //enum class State : unsigned { Idle, DMA, Execute } state;
   #include "registers.hpp"
 
+  //cartridge.mapping entries routed to rom_read() and dsp_read(); load() resolves
+  //them to bus slots so that DMA can move bytes without going through the bus
+  linear_vector<unsigned> rom_mappings;
+  linear_vector<unsigned> dsp_mappings;
+  struct BusOwner { enum e { None, ROM, DSP }; };
+  uint8 bus_owner[256];
+
   static void Enter();
   void enter();
 
@@ -31,6 +38,8 @@ public:
   uint8 dsp_read(unsigned addr);
   void dsp_write(unsigned addr, uint8 data);
 
+  void dma_transfer();
+
   //opcodes.cpp
   void push();
   void pull();
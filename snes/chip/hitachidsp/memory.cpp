@@ -24,6 +24,32 @@ uint8 HitachiDSP::rom_read(unsigned addr) {
 void HitachiDSP::rom_write(unsigned addr, uint8 data) {
 }
 
+//the transfer never yields, so its cost is charged by the caller as one step.
+//bytes read from the Cx4 ROM window or written to its data RAM skip the bus;
+//everything else (cheats, MMIO, memory owned by other chips) takes the bus path.
+void HitachiDSP::dma_transfer() {
+  for(unsigned n = 0; n < regs.dma_length; n++) {
+    unsigned source = regs.dma_source + n;
+    unsigned target = regs.dma_target + n;
+    uint8 data;
+
+    if(source <= 0xffffff && bus_owner[bus.lookup[source]] == BusOwner::ROM && !cheat.override[source]) {
+      data = cartridge.rom.read(bus.target[source]);
+    } else {
+      data = bus.read(source);
+    }
+
+    if(target <= 0xffffff && bus_owner[bus.lookup[target]] == BusOwner::DSP) {
+      unsigned addr = bus.target[target] & 0x1fff;
+      if((addr <= 0x0bff) || (addr >= 0x1000 && addr <= 0x1bff)) {
+        dataRAM[addr & 0x0fff] = data;
+        continue;
+      }
+    }
+    bus.write(target, data);
+  }
+}
+
 uint8 HitachiDSP::dsp_read(unsigned addr) {
   addr &= 0x1fff;
 
@@ -93,7 +119,10 @@ void HitachiDSP::dsp_write(unsigned addr, uint8 data) {
   case 0x1f45: regs.dma_target = (regs.dma_target & 0xffff00) | (data <<  0); return;
   case 0x1f46: regs.dma_target = (regs.dma_target & 0xff00ff) | (data <<  8); return;
   case 0x1f47: regs.dma_target = (regs.dma_target & 0x00ffff) | (data << 16);
-    if(state.i == State::Idle) state.i = State::DMA;
+    if(state.i == State::Idle) {
+      state.i = State::DMA;
+      wake();
+    }
     return;
   case 0x1f48: regs.r1f48 = data & 0x01; return;
   case 0x1f49: regs.program_offset = (regs.program_offset & 0xffff00) | (data <<  0); return;
@@ -106,6 +135,7 @@ void HitachiDSP::dsp_write(unsigned addr, uint8 data) {
     if(state.i == State::Idle) {
       regs.pc = regs.page_number * 256 + regs.program_counter;
       state.i = State::Execute;
+      wake();
     }
     return;
   case 0x1f50: regs.r1f50 = data & 0x77; return;
@@ -2,6 +2,7 @@
 
 void HitachiDSP::serialize(serializer &s) {
   Processor::serialize(s);
+  s.integer(asleep);
 
   s.array(dataRAM);
   foreach(n, stack) s.integer(n);
@@ -23,7 +23,7 @@ void ICD2::enter() {
       GameBoy::system.clocks_executed = 0;
     } else {  //DMG halted
       audio.coprocessor_sample(0x0000, 0x0000);
-      step(1);
+      step(GameBoy::APU::Master::Divider);
     }
     synchronize_cpu();
   }
@@ -40,7 +40,7 @@ void ICD2::unload() {
 
 void ICD2::power() {
   audio.coprocessor_enable(true);
-  audio.coprocessor_frequency(4 * 1024 * 1024);
+  audio.coprocessor_frequency(4 * 1024 * 1024 / GameBoy::APU::Master::Divider);
 }
 
 void ICD2::reset() {
@@ -13,6 +13,7 @@ void SA1::mmio_w2200(uint8 data) {
   mmio.sa1_resb = (data & 0x20);
   mmio.sa1_nmi  = (data & 0x10);
   mmio.smeg     = (data & 0x0f);
+  if(!mmio.sa1_rdyb && !mmio.sa1_resb) wake();
 
   if(mmio.sa1_irq) {
     mmio.sa1_irqfl = true;
@@ -20,9 +20,13 @@ void SA1::enter() {
     }
 
     if(mmio.sa1_rdyb || mmio.sa1_resb) {
-      //SA-1 co-processor is asleep
-      tick();
-      synchronize_cpu();
+      //SA-1 co-processor is asleep. tick() can sync to the S-CPU, which may
+      //release the SA-1 before sleep() is reached; its wake() would then be lost
+      if(!asleep) {
+        tick();
+        if(!mmio.sa1_rdyb && !mmio.sa1_resb) continue;
+      }
+      sleep();
       continue;
     }
 
@@ -83,7 +87,36 @@ bool SA1::interrupt_pending() {
 void SA1::tick() {
   step(2);
   if(++status.tick_counter == 0) synchronize_cpu();
+  tick_counters();
+}
+
+//run the ticks the sleep loop would have run by the time it caught up with the S-CPU.
+//without a timer IRQ to test for, the counters advance in closed form.
+void SA1::idle() {
+  int64 quantum = 2 * (int64)cpu.frequency;
+  unsigned ticks = (quantum - 1 - clock) / quantum;
+  clock += ticks * quantum;
+  status.tick_counter += ticks;
+
+  if(mmio.hen == 0 && mmio.ven == 0) {
+    if(mmio.hvselb == 0 && status.hcounter < 1364 && status.vcounter < status.scanlines) {
+      unsigned hcounter = status.hcounter + ticks * 2;
+      status.vcounter = (status.vcounter + hcounter / 1364) % status.scanlines;
+      status.hcounter = hcounter % 1364;
+      return;
+    }
+    if(mmio.hvselb == 1 && status.hcounter <= 0x07ff) {
+      unsigned hcounter = status.hcounter + ticks * 2;
+      status.vcounter = (status.vcounter + (hcounter >> 11)) & 0x01ff;
+      status.hcounter = hcounter & 0x07ff;
+      return;
+    }
+  }
+
+  while(ticks--) tick_counters();
+}
 
+void SA1::tick_counters() {
   //adjust counters:
   //note that internally, status counters are in clocks;
   //whereas MMIO register counters are in dots (4 clocks = 1 dot)
@@ -131,7 +164,8 @@ void SA1::power() {
 }
 
 void SA1::reset() {
-  create(SA1::Enter, system.cpu_frequency);
+  create(SA1::Enter, system.cpu_frequency, ShallowStack);
+  asleep = false;
 
   cpubwram.dma = false;
   for(unsigned addr = 0; addr < iram.size(); addr++) {
@@ -18,6 +18,8 @@ public:
   static void Enter();
   void enter();
   void tick();
+  void idle();
+  alwaysinline void tick_counters();
   void op_irq();
 
   alwaysinline void trigger_irq();
@@ -2,6 +2,7 @@
 
 void SA1::serialize(serializer &s) {
   Processor::serialize(s);
+  s.integer(asleep);
   CPUcore::core_serialize(s);
 
   //sa1.hpp
@@ -0,0 +1,88 @@
+#ifdef SDD1_CPP
+
+//decompressed output depends only on the source address and the ROM banks mapped in, so
+//each source is decompressed once into a block; later transfers from the same source
+//(at the same or a shorter length) then stream straight from it.
+
+SDD1::Block* SDD1::cache_fetch(unsigned addr, unsigned size) {
+  unsigned banks = (mmc[0] >> 20) | (mmc[1] >> 20) << 8 | (mmc[2] >> 20) << 16 | (mmc[3] >> 20) << 24;
+
+  Block *block = 0, *lru = &cache[0];
+  for(unsigned n = 0; n < CacheBlocks; n++) {
+    if(cache[n].used && cache[n].addr == addr && cache[n].banks == banks) {
+      block = &cache[n];
+      break;
+    }
+    if(cache[n].used < lru->used) lru = &cache[n];
+  }
+
+  if(block && block->size >= size) {
+    block->used = ++cache_time;
+    return block;
+  }
+
+  //miss, or the cached block is too short: refill the least recently used slot
+  if(block == 0) block = lru;
+  cache_release(*block);
+  block->addr = addr;
+  block->banks = banks;
+  block->used = ++cache_time;
+
+  //a precomputed image holding enough of the output is used in place
+  unsigned length;
+  const uint8 *image = cartridge.decompression.find(addr, banks, length);
+  if(image && length >= size) {
+    block->size = length;
+    block->data = image;
+    block->mapped = true;
+    return block;
+  }
+
+  while(cache_bytes + size > CacheBytes) {
+    Block *oldest = 0;
+    for(unsigned n = 0; n < CacheBlocks; n++) {
+      if(cache[n].used && !cache[n].mapped && (!oldest || cache[n].used < oldest->used)) oldest = &cache[n];
+    }
+    cache_release(*oldest);
+  }
+
+  uint8 *data = new uint8[size];
+  decomp.init(addr);
+  for(unsigned n = 0; n < size; n++) data[n] = decomp.read();
+  cartridge.decompression.record(addr, banks, data, size);
+
+  block->size = size;
+  block->data = data;
+  block->mapped = false;
+  cache_bytes += size;
+  return block;
+}
+
+void SDD1::cache_release(Block &block) {
+  if(block.used == 0) return;
+  if(block.mapped == false) {
+    delete[] block.data;
+    cache_bytes -= block.size;
+  }
+  block.data = 0;
+  block.used = 0;
+}
+
+void SDD1::cache_flush() {
+  for(unsigned n = 0; n < CacheBlocks; n++) cache_release(cache[n]);
+  cache_time = 0;
+  stream = 0;
+}
+
+uint8 SDD1::stream_read() {
+  if(stream_offset < stream->size) return stream->data[stream_offset++];
+
+  //the transfer outlasted its block: continue with the live decoder past the cached bytes
+  if(stream_offset++ == stream->size) {
+    decomp.init(stream->addr);
+    for(unsigned n = 0; n < stream->size; n++) decomp.read();
+  }
+  return decomp.read();
+}
+
+#endif
@@ -6,6 +6,7 @@ namespace SNES {
 SDD1 sdd1;
 
 #include "decomp.cpp"
+#include "cache.cpp"
 #include "serialization.cpp"
 
 void SDD1::init() {
@@ -18,9 +19,11 @@ void SDD1::load() {
   function<void(unsigned,uint8)> writer(&SDD1::mmio_write, &sdd1);
   bus.map(Bus::MapMode::Direct, 0x00, 0x3f, 0x4300, 0x437f, reader, writer);
   bus.map(Bus::MapMode::Direct, 0x80, 0xbf, 0x4300, 0x437f, reader, writer);
+  cache_flush();
 }
 
 void SDD1::unload() {
+  cache_flush();
 }
 
 void SDD1::power() {
@@ -30,6 +33,7 @@ void SDD1::reset() {
   sdd1_enable = 0x00;
   xfer_enable = 0x00;
   dma_ready = false;
+  stream = 0;
 
   mmc[0] = 0 << 20;
   mmc[1] = 1 << 20;
@@ -89,7 +93,9 @@ void SDD1::mmio_write(unsigned addr, uint8 data) {
 }
 
 uint8 SDD1::rom_read(unsigned addr) {
-  return cartridge.rom.read(mmc[(addr >> 20) & 3] + (addr & 0x0fffff));
+  unsigned offset = mmc[(addr >> 20) & 3] + (addr & 0x0fffff);
+  if(offset >= cartridge.rom.size()) offset = bus.mirror(offset & 0xffffff, cartridge.rom.size());
+  return cartridge.rom.read(offset);
 }
 
 //SDD1::mcu_read() is mapped to $c0-ff:0000-ffff
@@ -117,14 +123,15 @@ uint8 SDD1::mcu_read(unsigned addr) {
       if(sdd1_enable & xfer_enable & (1 << i)) {
         //S-DD1 always uses fixed transfer mode, so address will not change during transfer
         if(addr == dma[i].addr) {
-          if(!dma_ready) {
+          if(!dma_ready || !stream) {
             //prepare streaming decompression
-            decomp.init(addr);
+            stream = cache_fetch(addr, dma[i].size ? dma[i].size : 0x10000);
+            stream_offset = 0;
             dma_ready = true;
           }
 
           //fetch a decompressed byte; once finished, disable channel and invalidate buffer
-          uint8 data = decomp.read();
+          uint8 data = stream_read();
           if(--dma[i].size == 0) {
             dma_ready = false;
             xfer_enable &= ~(1 << i);
@@ -137,16 +144,25 @@ uint8 SDD1::mcu_read(unsigned addr) {
   }  //S-DD1 decompressor enabled
 
   //S-DD1 decompression mode inactive; return ROM data
-  return cartridge.rom.read(mmc[(addr >> 20) & 3] + (addr & 0x0fffff));
+  return rom_read(addr);
 }
 
 void SDD1::mcu_write(unsigned addr, uint8 data) {
 }
 
 SDD1::SDD1() {
+  for(unsigned n = 0; n < CacheBlocks; n++) {
+    cache[n].used = 0;
+    cache[n].data = 0;
+    cache[n].mapped = false;
+  }
+  cache_bytes = 0;
+  cache_time = 0;
+  stream = 0;
 }
 
 SDD1::~SDD1() {
+  cache_flush();
 }
 
 }
@@ -28,6 +28,26 @@ private:
     uint16 size;      //$43x5-$43x6 -- DMA transfer size
   } dma[8];
 
+  struct Block {
+    unsigned addr;    //DMA source address
+    unsigned size;    //decompressed bytes held
+    unsigned banks;   //mmc[] bank numbers, one per byte
+    unsigned used;    //LRU timestamp; 0 = empty slot
+    bool mapped;      //data points into the precomputed image rather than the heap
+    const uint8 *data;
+  };
+  enum { CacheBlocks = 64, CacheBytes = 2 * 1024 * 1024 };
+  Block cache[CacheBlocks];
+  unsigned cache_bytes;
+  unsigned cache_time;
+  Block *stream;           //block feeding the active transfer
+  unsigned stream_offset;
+
+  Block* cache_fetch(unsigned addr, unsigned size);
+  void cache_release(Block &block);
+  void cache_flush();
+  uint8 stream_read();
+
 public:
   #include "decomp.hpp"
   Decomp decomp;
@@ -1,6 +1,13 @@
 #ifdef SPC7110_CPP
 
 uint8 SPC7110::Decomp::read() {
+  if(image) {
+    if(image_index < image_length) return image[image_index++];
+    //the stream outlasted the precomputed output: continue with the live decoder
+    image = 0;
+    start(decomp_mode, stream_offset, image_index);
+  }
+
   if(decomp_buffer_length == 0) {
     //decompress at least (decomp_buffer_size / 2) bytes to the buffer
     switch(decomp_mode) {
@@ -21,6 +28,7 @@ void SPC7110::Decomp::write(uint8 data) {
   decomp_buffer[decomp_buffer_wroffset++] = data;
   decomp_buffer_wroffset &= decomp_buffer_size - 1;
   decomp_buffer_length++;
+  if(cartridge.decompression.tracing) traced.append(data);
 }
 
 uint8 SPC7110::Decomp::dataread() {
@@ -30,6 +38,41 @@ uint8 SPC7110::Decomp::dataread() {
 }
 
 void SPC7110::Decomp::init(unsigned mode, unsigned offset, unsigned index) {
+  flush();
+  stream_offset = offset;
+
+  image = mode <= 2 ? cartridge.decompression.find(offset, mode, image_length) : 0;
+  if(image && index < image_length) {
+    decomp_mode = mode;
+    image_index = index;
+    return;
+  }
+
+  image = 0;
+  start(mode, offset, index);
+}
+
+//hand the traced output of the finished stream to the cartridge
+void SPC7110::Decomp::flush() {
+  if(traced.size() == 0) return;
+  cartridge.decompression.record(stream_offset, decomp_mode, &traced[0], traced.size());
+  traced.reset();
+}
+
+//trace the first length bytes of a stream the game has not necessarily played.
+//the mode decoders keep their state in statics, so this must not run inside a live
+//stream; the caller starts its stream with init() afterwards.
+void SPC7110::Decomp::walk(unsigned mode, unsigned offset, unsigned length) {
+  flush();
+  image = 0;
+  stream_offset = offset;
+  start(mode, offset, 0);
+  while(traced.size() < length) read();
+  flush();
+}
+
+void SPC7110::Decomp::start(unsigned mode, unsigned offset, unsigned index) {
+  traced.reset();
   decomp_mode = mode;
   decomp_offset = offset;
 
@@ -479,7 +522,12 @@ unsigned SPC7110::Decomp::deinterleave_4x8(unsigned data) {
 void SPC7110::Decomp::reset() {
   //mode 3 is invalid; this is treated as a special case to always return 0x00
   //set to mode 3 so that reading decomp port before starting first decomp will return 0x00
+  flush();
   decomp_mode = 3;
+  image = 0;
+  image_length = 0;
+  image_index = 0;
+  stream_offset = 0;
 
   decomp_buffer_rdoffset = 0;
   decomp_buffer_wroffset = 0;
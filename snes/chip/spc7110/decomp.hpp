@@ -3,6 +3,8 @@ public:
   uint8 read();
   void init(unsigned mode, unsigned offset, unsigned index);
   void reset();
+  void flush();
+  void walk(unsigned mode, unsigned offset, unsigned length);
 
   void serialize(serializer&);
   Decomp();
@@ -12,6 +14,15 @@ private:
   unsigned decomp_mode;
   unsigned decomp_offset;
 
+  //precomputed output of the active stream, from Cartridge::Decompression
+  const uint8 *image;
+  unsigned image_length;
+  unsigned image_index;      //next output byte
+  unsigned stream_offset;    //data ROM offset the stream started at
+  linear_vector<uint8> traced;  //live output of the active stream, while tracing
+
+  void start(unsigned mode, unsigned offset, unsigned index);
+
   //read() will spool chunks half the size of decomp_buffer_size
   enum { decomp_buffer_size = 64 }; //must be >= 64, and must be a power of two
   uint8 *decomp_buffer;
@@ -13,6 +13,16 @@ void SPC7110::Decomp::serialize(serializer &s) {
     s.integer(context[n].index);
     s.integer(context[n].invert);
   }
+
+  bool image_active = image != 0;
+  s.integer(image_active);
+  s.integer(image_index);
+  s.integer(stream_offset);
+  if(s.mode() == serializer::Load) {
+    traced.reset();
+    image = image_active ? cartridge.decompression.find(stream_offset, decomp_mode, image_length) : 0;
+    if(image_active && !image) start(decomp_mode, stream_offset, image_index);
+  }
 }
 
 void SPC7110::serialize(serializer &s) {
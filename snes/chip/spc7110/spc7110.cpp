@@ -21,6 +21,8 @@ void SPC7110::load() {
 }
 
 void SPC7110::unload() {
+  decomp.flush();
+  traced_tables.reset();
 }
 
 void SPC7110::power() {
@@ -95,6 +97,26 @@ unsigned SPC7110::datarom_addr(unsigned addr) {
   return data_rom_offset + addr;
 }
 
+//while tracing, decode every entry of a directory table the first time the game uses it,
+//so the image covers all 256 streams it can select, not only those a session played.
+//each stream is kept up to the reach of the 16-bit length counter ($4809-$480a); reads
+//beyond that, or starting past it via $4805-$4806, continue on the live decoder.
+void SPC7110::trace_directory(unsigned table) {
+  for(unsigned n = 0; n < traced_tables.size(); n++) {
+    if(traced_tables[n] == table) return;
+  }
+  traced_tables.append(table);
+
+  for(unsigned index = 0; index < 256; index++) {
+    unsigned addr   = datarom_addr(table + (index << 2));
+    unsigned mode   = (cartridge.rom.read(addr + 0));
+    unsigned offset = (cartridge.rom.read(addr + 1) << 16)
+                    + (cartridge.rom.read(addr + 2) <<  8)
+                    + (cartridge.rom.read(addr + 3) <<  0);
+    if(mode <= 2) decomp.walk(mode, offset, 0x10000);
+  }
+}
+
 unsigned SPC7110::data_pointer()   { return r4811 + (r4812 << 8) + (r4813 << 16); }
 unsigned SPC7110::data_adjust()    { return r4814 + (r4815 << 8); }
 unsigned SPC7110::data_increment() { return r4816 + (r4817 << 8); }
@@ -365,6 +387,7 @@ void SPC7110::mmio_write(unsigned addr, uint8 data) {
                        + (cartridge.rom.read(addr + 2) <<  8)
                        + (cartridge.rom.read(addr + 3) <<  0);
 
+      if(cartridge.decompression.tracing) trace_directory(table);
       decomp.init(mode, offset, (r4805 + (r4806 << 8)) << mode);
       r480c = 0x80;
     } break;
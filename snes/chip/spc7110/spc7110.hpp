@@ -61,6 +61,9 @@ private:
 
   #include "decomp.hpp"
   Decomp decomp;
+  linear_vector<unsigned> traced_tables;  //directory tables already walked, while tracing
+
+  void trace_directory(unsigned table);
 
   //==============
   //data port unit
@@ -68,7 +68,10 @@ void SuperFX::mmio_write(unsigned addr, uint8 data) {
       regs.r[n] = (data << 8) | (regs.r[n] & 0xff);
     }
 
-    if(addr == 0x301f) regs.sfr.g = 1;
+    if(addr == 0x301f) {
+      regs.sfr.g = 1;
+      wake();
+    }
     return;
   }
 
@@ -80,6 +83,7 @@ void SuperFX::mmio_write(unsigned addr, uint8 data) {
         regs.cbr = 0x0000;
         cache_flush();
       }
+      if(regs.sfr.g == 1) wake();
     } break;
 
     case 0x3031: {
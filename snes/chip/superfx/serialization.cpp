@@ -2,6 +2,7 @@
 
 void SuperFX::serialize(serializer &s) {
   Processor::serialize(s);
+  s.integer(asleep);
 
   //superfx.hpp
   s.integer(clockmode);
@@ -22,8 +22,13 @@ void SuperFX::enter() {
     }
 
     if(regs.sfr.g == 0) {
-      add_clocks(6);
-      synchronize_cpu();
+      //halted: sleep until the S-CPU sets GO. the step can sync to the S-CPU,
+      //which may set GO before sleep() is reached; its wake() would then be lost
+      if(!asleep) {
+        add_clocks(6);
+        if(regs.sfr.g) continue;
+      }
+      sleep();
       continue;
     }
 
@@ -43,6 +48,11 @@ void SuperFX::init() {
   regs.r[15].on_modify = bind( &SuperFX::r15_modify, this );
 }
 
+//the halted loop stepped six clocks at a time
+void SuperFX::idle() {
+  catchup(6);
+}
+
 void SuperFX::load() {
 }
 
@@ -54,7 +64,8 @@ void SuperFX::power() {
 }
 
 void SuperFX::reset() {
-  create(SuperFX::Enter, system.cpu_frequency);
+  create(SuperFX::Enter, system.cpu_frequency, ShallowStack);
+  asleep = false;
   instruction_counter = 0;
 
   for(unsigned n = 0; n < 16; n++) regs.r[n] = 0x0000;
@@ -9,6 +9,7 @@ public:
 
   static void Enter();
   void enter();
+  void idle();
   void init();
   void load();
   void unload();
@@ -48,8 +48,16 @@ void Controller::iobit(bool data) {
   }
 }
 
+//CRT raster detected, toggle iobit to latch counters
+void Controller::raster_latch() {
+  iobit(0);
+  iobit(1);
+}
+
+//only devices that must observe bus timing directly (Serial) create a thread
 Controller::Controller(bool port) : port(port) {
-  if(!thread) create(Controller::Enter, 1);
+  frequency = 0;
+  clock = 0;
 }
 
 }
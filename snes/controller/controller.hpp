@@ -25,6 +25,13 @@ struct Controller : Processor {
   void iobit(bool data);
   virtual uint2 data() { return 0; }
   virtual void latch(bool data) {}
+
+  //light guns do not run their own thread: at the start of every scanline the
+  //CPU asks where the CRT beam crosses the cursor, and schedules raster_latch()
+  //at that hcounter position. -1 means the cursor is not on this scanline.
+  virtual signed raster_position() { return -1; }
+  void raster_latch();
+
   Controller(bool port);
 };
 
@@ -1,43 +1,30 @@
 #ifdef CONTROLLER_CPP
 
-void Justifier::enter() {
-  unsigned prev = 0;
-  while(true) {
-    unsigned next = cpu.vcounter() * 1364 + cpu.hcounter();
-
-    signed x = (active == 0 ? player1.x : player2.x), y = (active == 0 ? player1.y : player2.y);
-    bool offscreen = (x < 0 || y < 0 || x >= 256 || y >= (ppu.overscan() ? 240 : 225));
-
-    if(offscreen == false) {
-      unsigned target = y * 1364 + (x + 24) * 4;
-      if(next >= target && prev < target) {
-        //CRT raster detected, toggle iobit to latch counters
-        iobit(0);
-        iobit(1);
-      }
-    }
-
-    if(next < prev) {
-      int nx1 = interface->inputPoll(port, Input::Device::Justifier, 0, (unsigned)Input::JustifierID::X);
-      int ny1 = interface->inputPoll(port, Input::Device::Justifier, 0, (unsigned)Input::JustifierID::Y);
-      nx1 += player1.x;
-      ny1 += player1.y;
-      player1.x = max(-16, min(256 + 16, nx1));
-      player1.y = max(-16, min(240 + 16, ny1));
-    }
-
-    if(next < prev && chained) {
-      int nx2 = interface->inputPoll(port, Input::Device::Justifiers, 1, (unsigned)Input::JustifierID::X);
-      int ny2 = interface->inputPoll(port, Input::Device::Justifiers, 1, (unsigned)Input::JustifierID::Y);
-      nx2 += player2.x;
-      ny2 += player2.y;
-      player2.x = max(-16, min(256 + 16, nx2));
-      player2.y = max(-16, min(240 + 16, ny2));
-    }
-
-    prev = next;
-    step(2);
+signed Justifier::raster_position() {
+  if(cpu.vcounter() == 0) {
+    //start of new frame; update cursor coordinates
+    int nx1 = interface->inputPoll(port, Input::Device::Justifier, 0, (unsigned)Input::JustifierID::X);
+    int ny1 = interface->inputPoll(port, Input::Device::Justifier, 0, (unsigned)Input::JustifierID::Y);
+    nx1 += player1.x;
+    ny1 += player1.y;
+    player1.x = max(-16, min(256 + 16, nx1));
+    player1.y = max(-16, min(240 + 16, ny1));
   }
+
+  if(cpu.vcounter() == 0 && chained) {
+    int nx2 = interface->inputPoll(port, Input::Device::Justifiers, 1, (unsigned)Input::JustifierID::X);
+    int ny2 = interface->inputPoll(port, Input::Device::Justifiers, 1, (unsigned)Input::JustifierID::Y);
+    nx2 += player2.x;
+    ny2 += player2.y;
+    player2.x = max(-16, min(256 + 16, nx2));
+    player2.y = max(-16, min(240 + 16, ny2));
+  }
+
+  signed x = (active == 0 ? player1.x : player2.x), y = (active == 0 ? player1.y : player2.y);
+  bool offscreen = (x < 0 || y < 0 || x >= 256 || y >= (ppu.overscan() ? 240 : 225));
+
+  if(offscreen || (signed)cpu.vcounter() != y) return -1;
+  return (x + 24) * 4;
 }
 
 uint2 Justifier::data() {
@@ -103,7 +90,6 @@ void Justifier::latch(bool data) {
 }
 
 Justifier::Justifier(bool port, bool chained) : Controller(port), chained(chained) {
-  create(Controller::Enter, 21477272);
   latched = 0;
   counter = 0;
   active = 0;
@@ -1,5 +1,5 @@
 struct Justifier : Controller {
-  void enter();
+  signed raster_position();
   uint2 data();
   void latch(bool data);
   Justifier(bool port, bool chained);
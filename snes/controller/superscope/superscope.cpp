@@ -12,34 +12,20 @@
 //require manual polling of PIO ($4201.d6) to determine when iobit was written.
 //Note that no commercial game ever utilizes a Super Scope in port 1.
 
-void SuperScope::enter() {
-  unsigned prev = 0;
-  while(true) {
-    unsigned next = cpu.vcounter() * 1364 + cpu.hcounter();
-
-    if(offscreen == false) {
-      unsigned target = y * 1364 + (x + 24) * 4;
-      if(next >= target && prev < target) {
-        //CRT raster detected, toggle iobit to latch counters
-        iobit(0);
-        iobit(1);
-      }
-    }
-
-    if(next < prev) {
-      //Vcounter wrapped back to zero; update cursor coordinates for start of new frame
-      int nx = interface->inputPoll(port, Input::Device::SuperScope, 0, (unsigned)Input::SuperScopeID::X);
-      int ny = interface->inputPoll(port, Input::Device::SuperScope, 0, (unsigned)Input::SuperScopeID::Y);
-      nx += x;
-      ny += y;
-      x = max(-16, min(256 + 16, nx));
-      y = max(-16, min(240 + 16, ny));
-      offscreen = (x < 0 || y < 0 || x >= 256 || y >= (ppu.overscan() ? 240 : 225));
-    }
-
-    prev = next;
-    step(2);
+signed SuperScope::raster_position() {
+  if(cpu.vcounter() == 0) {
+    //start of new frame; update cursor coordinates
+    int nx = interface->inputPoll(port, Input::Device::SuperScope, 0, (unsigned)Input::SuperScopeID::X);
+    int ny = interface->inputPoll(port, Input::Device::SuperScope, 0, (unsigned)Input::SuperScopeID::Y);
+    nx += x;
+    ny += y;
+    x = max(-16, min(256 + 16, nx));
+    y = max(-16, min(240 + 16, ny));
+    offscreen = (x < 0 || y < 0 || x >= 256 || y >= (ppu.overscan() ? 240 : 225));
   }
+
+  if(offscreen || (signed)cpu.vcounter() != y) return -1;
+  return (x + 24) * 4;
 }
 
 uint2 SuperScope::data() {
@@ -133,7 +119,6 @@ void SuperScope::serialize(serializer& s) {
 }
 
 SuperScope::SuperScope(bool port) : Controller(port) {
-  create(Controller::Enter, 21477272);
   latched = 0;
   counter = 0;
 
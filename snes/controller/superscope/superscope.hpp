@@ -1,5 +1,5 @@
 struct SuperScope : Controller {
-  void enter();
+  signed raster_position();
   uint2 data();
   void latch(bool data);
   void serialize(serializer &s);
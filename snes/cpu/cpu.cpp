@@ -23,9 +23,11 @@ void CPU::step(unsigned clocks) {
     Processor &chip = *coprocessors[i];
     chip.clock -= clocks * (uint64)chip.frequency;
   }
-  input.port1->clock -= clocks * (uint64)input.port1->frequency;
-  input.port2->clock -= clocks * (uint64)input.port2->frequency;
-  synchronize_controllers();
+  if(input.threaded) {
+    input.port1->clock -= clocks * (uint64)input.port1->frequency;
+    input.port2->clock -= clocks * (uint64)input.port2->frequency;
+    synchronize_controllers();
+  }
 }
 
 void CPU::synchronize_smp() {
@@ -46,14 +48,16 @@ void CPU::synchronize_ppu() {
 
 void CPU::synchronize_coprocessors() {
   for(unsigned i = 0; i < coprocessors.size(); i++) {
-    Processor &chip = *coprocessors[i];
-    if(chip.clock < 0) co_switch(chip.thread);
+    Coprocessor &chip = *coprocessors[i];
+    if(chip.clock >= 0) continue;
+    if(chip.asleep) chip.idle();
+    else co_switch(chip.thread);
   }
 }
 
 void CPU::synchronize_controllers() {
-  if(input.port1->clock < 0) co_switch(input.port1->thread);
-  if(input.port2->clock < 0) co_switch(input.port2->thread);
+  if(input.port1->thread && input.port1->clock < 0) co_switch(input.port1->thread);
+  if(input.port2->thread && input.port2->clock < 0) co_switch(input.port2->thread);
 }
 
 void CPU::Enter() { cpu.enter(); }
@@ -118,9 +122,9 @@ void CPU::enable() {
   read = function<uint8 (unsigned)>(cpu_default_read);
   write = function<void (unsigned, uint8)>(cpu_default_write);
 
-  bus.map(Bus::MapMode::Linear, 0x00, 0x3f, 0x0000, 0x1fff, read, write, 0x000000, 0x002000);
-  bus.map(Bus::MapMode::Linear, 0x80, 0xbf, 0x0000, 0x1fff, read, write, 0x000000, 0x002000);
-  bus.map(Bus::MapMode::Linear, 0x7e, 0x7f, 0x0000, 0xffff, read, write);
+  bus.passive[bus.map(Bus::MapMode::Linear, 0x00, 0x3f, 0x0000, 0x1fff, read, write, 0x000000, 0x002000)] = true;
+  bus.passive[bus.map(Bus::MapMode::Linear, 0x80, 0xbf, 0x0000, 0x1fff, read, write, 0x000000, 0x002000)] = true;
+  bus.passive[bus.map(Bus::MapMode::Linear, 0x7e, 0x7f, 0x0000, 0xffff, read, write)] = true;
 }
 
 void CPU::power() {
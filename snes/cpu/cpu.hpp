@@ -2,7 +2,7 @@ struct CPU : public Processor, public CPUcore, public PPUcounter {
   uint8 wram[128 * 1024];
 
   enum{ Threaded = true };
-  array<Processor*> coprocessors;
+  array<Coprocessor*> coprocessors;
   alwaysinline void step(unsigned clocks);
   alwaysinline void synchronize_smp();
   void synchronize_ppu();
@@ -51,6 +51,9 @@ private:
     unsigned hdma_position;
     bool hdma_triggered;
 
+    unsigned controller_latch_position[2];
+    bool controller_latched[2];
+
     bool nmi_valid;
     bool nmi_line;
     bool nmi_transition;
@@ -25,6 +25,9 @@ void CPU::serialize(serializer &s) {
   s.integer(status.hdma_position);
   s.integer(status.hdma_triggered);
 
+  s.array(status.controller_latch_position);
+  s.array(status.controller_latched);
+
   s.integer(status.nmi_valid);
   s.integer(status.nmi_line);
   s.integer(status.nmi_transition);
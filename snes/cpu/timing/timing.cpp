@@ -23,6 +23,16 @@ void CPU::add_clocks(unsigned clocks) {
     step_auto_joypad_poll();
   }
 
+  if(status.controller_latched[0] == false && hcounter() >= status.controller_latch_position[0]) {
+    status.controller_latched[0] = true;
+    input.port1->raster_latch();
+  }
+
+  if(status.controller_latched[1] == false && hcounter() >= status.controller_latch_position[1]) {
+    status.controller_latched[1] = true;
+    input.port2->raster_latch();
+  }
+
   if(status.dram_refreshed == false && hcounter() >= status.dram_refresh_position) {
     status.dram_refreshed = true;
     add_clocks(40);
@@ -57,6 +67,15 @@ void CPU::scanline() {
     status.hdma_position = 1104;
     status.hdma_triggered = false;
   }
+
+  //light guns latch the counters where the beam crosses their cursor
+  signed position;
+  position = input.port1->raster_position();
+  status.controller_latch_position[0] = max(0, position);
+  status.controller_latched[0] = position < 0;
+  position = input.port2->raster_position();
+  status.controller_latch_position[1] = max(0, position);
+  status.controller_latched[1] = position < 0;
 }
 
 void CPU::alu_edge() {
@@ -168,6 +187,11 @@ void CPU::timing_reset() {
   status.hdma_position = 1104;
   status.hdma_triggered = false;
 
+  status.controller_latch_position[0] = 0;
+  status.controller_latch_position[1] = 0;
+  status.controller_latched[0] = true;
+  status.controller_latched[1] = true;
+
   status.nmi_valid      = false;
   status.nmi_line       = false;
   status.nmi_transition = false;
@@ -1,6 +1,7 @@
 #include "libretro.h"
 #include <snes/snes.hpp>
 
+#include <nall/filemap.hpp>
 #include <nall/snes/cartridge.hpp>
 #include <nall/gameboy/cartridge.hpp>
 
@@ -224,8 +225,16 @@ void retro_set_environment(retro_environment_t environ_cb)
       { NULL },
    };
 
+   // Ask the frontend to keep the content buffer alive so the ROM can be mapped without a copy.
+   static const struct retro_system_content_info_override content_overrides[] = {
+      { "sfc|smc", false, true },
+      { NULL, false, false },
+   };
+
    environ_cb(RETRO_ENVIRONMENT_SET_SUBSYSTEM_INFO, (void*)subsystems);
 
+   environ_cb(RETRO_ENVIRONMENT_SET_CONTENT_INFO_OVERRIDE, (void*)content_overrides);
+
    environ_cb(RETRO_ENVIRONMENT_SET_CONTROLLER_INFO, (void*)ports);
 }
 
@@ -336,12 +345,93 @@ void retro_get_system_av_info(struct retro_system_av_info *info) {
   info->geometry  = geom;
 }
 
+static filemap rom_filemap;
+
+//map the base ROM without copying it when possible:
+//the frontend buffer is used directly if it is guaranteed to outlive the game;
+//otherwise a read-only mapping of the file is shared with every other instance,
+//provided its contents match what the frontend loaded. A soft-patched image of
+//the same size maps the file copy-on-write instead and writes only the patched
+//bytes, so every page the patch leaves alone stays shared with the base ROM.
+static void snes_map_rom(const char *rom_path, const uint8_t *rom_data, unsigned rom_size) {
+  const struct retro_game_info_ext *ext = 0;
+  if(!interface.penviron(RETRO_ENVIRONMENT_GET_GAME_INFO_EXT, &ext)) ext = 0;
+
+  if(ext && ext->persistent_data && ext->data == rom_data) {
+    return SNES::cartridge.rom.share(rom_data, rom_size);
+  }
+
+  if(rom_path && !(ext && ext->file_in_archive) && rom_filemap.open(rom_path, filemap::mode::read)) {
+    unsigned offset = rom_filemap.size() - rom_size;  //skip copier header, if present
+    if(rom_filemap.size() < rom_size || (offset != 0 && offset != 512)) {
+      rom_filemap.close();
+    } else if(memcmp(rom_filemap.data() + offset, rom_data, rom_size) == 0) {
+      return SNES::cartridge.rom.share(rom_filemap.data() + offset, rom_size);
+    } else {
+      rom_filemap.close();
+      if(rom_filemap.open(rom_path, filemap::mode::copyonwrite)) {
+        //pages are counted from the start of the file, so a copier header does not make
+        //every chunk straddle two pages; within a page, only the differing bytes are stored
+        uint8_t *image = rom_filemap.data() + offset;
+        for(unsigned page = 0; page < offset + rom_size; page += 4096) {
+          unsigned first = max(page, offset) - offset;
+          unsigned last = min(page + 4096, offset + rom_size) - offset;
+          if(memcmp(image + first, rom_data + first, last - first) == 0) continue;
+          for(unsigned n = first; n < last;) {
+            if(image[n] == rom_data[n]) { n++; continue; }
+            unsigned run = n;
+            while(n < last && image[n] != rom_data[n]) n++;
+            memcpy(image + run, rom_data + run, n - run);
+          }
+        }
+        return SNES::cartridge.rom.share(image, rom_size);
+      }
+    }
+  }
+
+  SNES::cartridge.rom.copy(rom_data, rom_size);
+}
+
+static filemap decompression_filemap;
+static string decompression_trace;
+
+//S-DD1 and SPC7110 titles may ship a precomputed decompression image (<rom>.dcx, see
+//snes/cartridge/decompression.cpp) that replaces the live decoder on every hit.
+//An empty image file asks for one instead, written when the game is unloaded. For the
+//SPC7110 it holds every entry of each directory table the game selects; the S-DD1 has no
+//directory, so its image holds the blocks this session transferred, and other blocks stay
+//on the live decoder.
+static void snes_map_decompression(const char *rom_path) {
+  if(!rom_path || !(SNES::cartridge.has_sdd1() || SNES::cartridge.has_spc7110())) return;
+  string filename(interface.basename, ".dcx");
+  if(file::exists(filename) == false) return;
+
+  if(file::size(filename) == 0) {
+    SNES::cartridge.decompression.trace(SNES::cartridge.crc32());
+    decompression_trace = filename;
+    return;
+  }
+
+  if(decompression_filemap.open(filename, filemap::mode::read)) {
+    if(SNES::cartridge.decompression.load(decompression_filemap.data(), decompression_filemap.size(), SNES::cartridge.crc32())) return;
+    decompression_filemap.close();
+  }
+}
+
+static void snes_unmap_decompression() {
+  if(decompression_trace != "") SNES::cartridge.decompression.save(decompression_trace);
+  decompression_trace = "";
+  SNES::cartridge.decompression.unload();
+  decompression_filemap.close();
+}
+
 static bool snes_load_cartridge_normal(
-  const char *rom_xml, const uint8_t *rom_data, unsigned rom_size
+  const char *rom_path, const char *rom_xml, const uint8_t *rom_data, unsigned rom_size
 ) {
-  if(rom_data) SNES::cartridge.rom.copy(rom_data, rom_size);
+  if(rom_data) snes_map_rom(rom_path, rom_data, rom_size);
   string xmlrom = (rom_xml && *rom_xml) ? string(rom_xml) : SnesCartridge(rom_data, rom_size).markup;
   SNES::cartridge.load(SNES::Cartridge::Mode::Normal, xmlrom);
+  snes_map_decompression(rom_path);
   SNES::system.power();
   return true;
 }
@@ -492,7 +582,7 @@ bool retro_load_game(const struct retro_game_info *info) {
        *dot = '\0';
   }
 
-  return snes_load_cartridge_normal(info->meta, (const uint8_t*)info->data, info->size);
+  return snes_load_cartridge_normal(info->path, info->meta, (const uint8_t*)info->data, info->size);
 }
 
 bool retro_load_game_special(unsigned game_type,
@@ -532,6 +622,8 @@ bool retro_load_game_special(unsigned game_type,
 
 void retro_unload_game(void) {
   SNES::cartridge.unload();
+  snes_unmap_decompression();
+  rom_filemap.close();
 }
 
 unsigned retro_get_region(void) {
@@ -851,6 +851,23 @@ enum retro_mod
                                             * Returns the specified language of the frontend, if specified by the user.
                                             * It can be used by the core for localization purposes.
                                             */
+#define RETRO_ENVIRONMENT_SET_CONTENT_INFO_OVERRIDE 65
+                                           /* const struct retro_system_content_info_override * --
+                                            * Allows an implementation to override 'global' content
+                                            * info parameters reported by retro_get_system_info().
+                                            * A NULL-terminated array; only the first matching entry
+                                            * for a given extension is used.
+                                            * Setting 'persistent_data' requests that the frontend keep
+                                            * the buffer passed to retro_load_game() valid until
+                                            * retro_unload_game() returns.
+                                            */
+#define RETRO_ENVIRONMENT_GET_GAME_INFO_EXT 66
+                                           /* const struct retro_game_info_ext ** --
+                                            * Allows an implementation to fetch extended game
+                                            * information, including whether the content buffer
+                                            * is guaranteed to persist for the lifetime of the game.
+                                            * Only valid inside retro_load_game().
+                                            */
 
 #define RETRO_MEMDESC_CONST     (1 << 0)   /* The frontend will never change this memory area once retro_load_game has returned. */
 #define RETRO_MEMDESC_BIGENDIAN (1 << 1)   /* The memory area contains big endian data. Default is little endian. */
@@ -1779,6 +1796,29 @@ struct retro_game_info
    const char *meta;       /* String of implementation specific meta-data. */
 };
 
+struct retro_system_content_info_override
+{
+   const char *extensions; /* '|' separated list of extensions this entry applies to. */
+   bool need_fullpath;     /* Overrides retro_system_info::need_fullpath. */
+   bool persistent_data;   /* Frontend keeps retro_game_info::data valid until unload. */
+};
+
+struct retro_game_info_ext
+{
+   const char *full_path;  /* Path to content including archive, if any. */
+   const char *archive_path;
+   const char *archive_file;
+   const char *dir;        /* Parent directory of content. */
+   const char *name;       /* Content name without extension. */
+   const char *ext;        /* Content extension, lowercase. */
+   const char *meta;       /* String of implementation specific meta-data. */
+   const void *data;       /* Memory buffer of loaded game. */
+   size_t size;            /* Size of memory buffer. */
+   bool file_in_archive;   /* True if content was loaded from an archive. */
+   bool persistent_data;   /* True if 'data' remains valid until
+                            * retro_unload_game() returns. */
+};
+
 /* Callbacks */
 
 /* Environment callback. Gives implementations a way of performing
@@ -19,11 +19,12 @@ StaticRAM::~StaticRAM() { delete[] data_; }
 
 void MappedRAM::reset() {
   if(data_) {
-    delete[] data_;
+    if(!shared_) delete[] data_;
     data_ = 0;
   }
   size_ = 0;
   write_protect_ = false;
+  shared_ = false;
 }
 
 void MappedRAM::map(uint8 *source, unsigned length) {
@@ -33,6 +34,7 @@ void MappedRAM::map(uint8 *source, unsigned length) {
 }
 
 void MappedRAM::copy(const uint8 *data, unsigned size) {
+  if(shared_) reset();
   if(!data_) {
     size_ = (size & ~255) + ((bool)(size & 255) << 8);
     data_ = new uint8[size_]();
@@ -40,14 +42,26 @@ void MappedRAM::copy(const uint8 *data, unsigned size) {
   memcpy(data_, data, min(size_, size));
 }
 
-void MappedRAM::write_protect(bool status) { write_protect_ = status; }
+//map caller-owned memory that must outlive this object; never written or freed.
+//sizes that are not a multiple of 256 bytes fall back to copy(), which pads them.
+void MappedRAM::share(const uint8 *data, unsigned size) {
+  if(size & 255) return copy(data, size);
+  reset();
+  data_ = const_cast<uint8*>(data);
+  size_ = data_ ? size : 0;
+  write_protect_ = true;
+  shared_ = true;
+}
+
+bool MappedRAM::shared() const { return shared_; }
+void MappedRAM::write_protect(bool status) { if(!shared_) write_protect_ = status; }
 uint8* MappedRAM::data() { return data_; }
 unsigned MappedRAM::size() const { return size_; }
 
 uint8 MappedRAM::read(unsigned addr) { return data_[addr]; }
 void MappedRAM::write(unsigned addr, uint8 n) { if(!write_protect_) data_[addr] = n; }
 const uint8& MappedRAM::operator[](unsigned addr) const { return data_[addr]; }
-MappedRAM::MappedRAM() : data_(0), size_(0), write_protect_(false) {}
+MappedRAM::MappedRAM() : data_(0), size_(0), write_protect_(false), shared_(false) {}
 
 //Bus
 
@@ -23,7 +23,7 @@ unsigned Bus::mirror(unsigned addr, unsigned size) {
   return base;
 }
 
-void Bus::map(
+unsigned Bus::map(
   MapMode::e mode,
   unsigned bank_lo, unsigned bank_hi,
   unsigned addr_lo, unsigned addr_hi,
@@ -37,19 +37,38 @@ void Bus::map(
   assert(id < 255);
   reader[id] = rd;
   writer[id] = wr;
+  passive[id] = false;
 
   if(length == 0) length = (bank_hi - bank_lo + 1) * (addr_hi - addr_lo + 1);
 
+  //mirror() is linear between multiples of the lowest set bit of length,
+  //so it only has to be evaluated where a run crosses one of them
+  unsigned granule = length & ~(length - 1);
+  unsigned width = addr_hi - addr_lo + 1;
   unsigned offset = 0;
   for(unsigned bank = bank_lo; bank <= bank_hi; bank++) {
-    for(unsigned addr = addr_lo; addr <= addr_hi; addr++) {
-      unsigned destaddr = (bank << 16) | addr;
-      if(mode == MapMode::Linear) destaddr = mirror(base + offset++, length);
-      if(mode == MapMode::Shadow) destaddr = mirror(base + destaddr, length);
-      lookup[(bank << 16) | addr] = id;
-      target[(bank << 16) | addr] = destaddr;
+    unsigned row = bank << 16;
+    memset(lookup + row + addr_lo, id, width);
+    uint32 *dest = target + row;
+
+    if(mode == MapMode::Direct) {
+      for(unsigned addr = addr_lo; addr <= addr_hi; addr++) dest[addr] = row | addr;
+      continue;
+    }
+
+    unsigned source = (mode == MapMode::Linear ? base + offset : base + (row | addr_lo));
+    unsigned destaddr = 0;
+    for(unsigned addr = addr_lo; addr <= addr_hi; addr++, source++) {
+      if(addr == addr_lo || (source & (granule - 1)) == 0 || source >= 1 << 24) {
+        destaddr = mirror(source, length);
+      } else {
+        destaddr++;
+      }
+      dest[addr] = destaddr;
     }
+    offset += width;
   }
+  return id;
 }
 
 static uint8 bus_reader_dummy(unsigned) {
@@ -68,7 +87,8 @@ void Bus::map_reset() {
 
 void Bus::map_xml() {
   foreach(m, cartridge.mapping) {
-    map(m.mode.i, m.banklo, m.bankhi, m.addrlo, m.addrhi, m.read, m.write, m.offset, m.size);
+    m.id = map(m.mode.i, m.banklo, m.bankhi, m.addrlo, m.addrhi, m.read, m.write, m.offset, m.size);
+    passive[m.id] = m.passive;
   }
 }
 
@@ -25,7 +25,9 @@ struct MappedRAM : Memory {
   inline void reset();
   inline void map(uint8*, unsigned);
   inline void copy(const uint8*, unsigned);
+  inline void share(const uint8*, unsigned);
 
+  inline bool shared() const;
   inline void write_protect(bool status);
   inline uint8* data();
   inline unsigned size() const;
@@ -39,6 +41,7 @@ private:
   uint8 *data_;
   unsigned size_;
   bool write_protect_;
+  bool shared_;
 };
 
 struct Bus {
@@ -53,9 +56,10 @@ struct Bus {
   unsigned idcount;
   function<uint8 (unsigned)> reader[256];
   function<void (unsigned, uint8)> writer[256];
+  bool passive[256];  //reads neither have side effects nor depend on timing (WRAM, cartridge ROM/RAM)
 
   struct MapMode { enum e { Direct, Linear, Shadow } i; };
-  void map(
+  unsigned map(
     MapMode::e mode,
     unsigned bank_lo, unsigned bank_hi,
     unsigned addr_lo, unsigned addr_hi,
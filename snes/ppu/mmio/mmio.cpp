@@ -414,6 +414,7 @@ void PPU::mmio_w2123(uint8 data) {
   window.regs.bg1_two_invert = data & 0x04;
   window.regs.bg1_one_enable = data & 0x02;
   window.regs.bg1_one_invert = data & 0x01;
+  window.coverage.valid = false;
 }
 
 //W34SEL
@@ -426,6 +427,7 @@ void PPU::mmio_w2124(uint8 data) {
   window.regs.bg3_two_invert = data & 0x04;
   window.regs.bg3_one_enable = data & 0x02;
   window.regs.bg3_one_invert = data & 0x01;
+  window.coverage.valid = false;
 }
 
 //WOBJSEL
@@ -438,26 +440,31 @@ void PPU::mmio_w2125(uint8 data) {
   window.regs.oam_two_invert = data & 0x04;
   window.regs.oam_one_enable = data & 0x02;
   window.regs.oam_one_invert = data & 0x01;
+  window.coverage.valid = false;
 }
 
 //WH0
 void PPU::mmio_w2126(uint8 data) {
   window.regs.one_left = data;
+  window.coverage.valid = false;
 }
 
 //WH1
 void PPU::mmio_w2127(uint8 data) {
   window.regs.one_right = data;
+  window.coverage.valid = false;
 }
 
 //WH2
 void PPU::mmio_w2128(uint8 data) {
   window.regs.two_left = data;
+  window.coverage.valid = false;
 }
 
 //WH3
 void PPU::mmio_w2129(uint8 data) {
   window.regs.two_right = data;
+  window.coverage.valid = false;
 }
 
 //WBGLOG
@@ -466,12 +473,14 @@ void PPU::mmio_w212a(uint8 data) {
   window.regs.bg3_mask = (data >> 4) & 3;
   window.regs.bg2_mask = (data >> 2) & 3;
   window.regs.bg1_mask = (data >> 0) & 3;
+  window.coverage.valid = false;
 }
 
 //WOBJLOG
 void PPU::mmio_w212b(uint8 data) {
   window.regs.col_mask = (data >> 2) & 3;
   window.regs.oam_mask = (data >> 0) & 3;
+  window.coverage.valid = false;
 }
 
 //TM
@@ -499,6 +508,7 @@ void PPU::mmio_w212e(uint8 data) {
   window.regs.bg3_main_enable = data & 0x04;
   window.regs.bg2_main_enable = data & 0x02;
   window.regs.bg1_main_enable = data & 0x01;
+  window.coverage.valid = false;
 }
 
 //TSW
@@ -508,6 +518,7 @@ void PPU::mmio_w212f(uint8 data) {
   window.regs.bg3_sub_enable = data & 0x04;
   window.regs.bg2_sub_enable = data & 0x02;
   window.regs.bg1_sub_enable = data & 0x01;
+  window.coverage.valid = false;
 }
 
 //CGWSEL
@@ -516,6 +527,7 @@ void PPU::mmio_w2130(uint8 data) {
   window.regs.col_sub_mask = (data >> 4) & 3;
   screen.regs.addsub_mode = data & 0x02;
   screen.regs.direct_color = data & 0x01;
+  window.coverage.valid = false;
 }
 
 //CGADDSUB
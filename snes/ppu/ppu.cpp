@@ -31,6 +31,27 @@ void PPU::synchronize_cpu() {
 
 void PPU::Enter() { ppu.enter(); }
 
+//first half of a dot: hires backgrounds output their subscreen pixel
+void PPU::dot_begin() {
+  bg1.run(1);
+  bg2.run(1);
+  bg3.run(1);
+  bg4.run(1);
+}
+
+//second half of a dot: main screen pixel and final composition
+void PPU::dot_end(signed pixel) {
+  bg1.run(0);
+  bg2.run(0);
+  bg3.run(0);
+  bg4.run(0);
+  if(pixel >= 0) {
+    sprite.run();
+    window.run();
+    screen.run();
+  }
+}
+
 void PPU::enter() {
   while(true) {
     if(scheduler.sync.i == Scheduler::SynchronizeMode::All) {
@@ -45,23 +66,24 @@ void PPU::enter() {
     bg4.begin();
 
     if(vcounter() <= 239) {
-      for(signed pixel = -7; pixel <= 255; pixel++) {
-        bg1.run(1);
-        bg2.run(1);
-        bg3.run(1);
-        bg4.run(1);
-        add_clocks(2);
-
-        bg1.run(0);
-        bg2.run(0);
-        bg3.run(0);
-        bg4.run(0);
-        if(pixel >= 0) {
-          sprite.run();
-          window.run();
-          screen.run();
+      for(signed pixel = -7; pixel <= 255;) {
+        //dots the S-CPU has already run past cannot see a register change,
+        //so render them back-to-back and advance the clock once for the span
+        signed span = min((int64)256 - pixel, -clock >> 2);
+        if(span > 0) {
+          for(signed n = 0; n < span; n++, pixel++) {
+            dot_begin();
+            dot_end(pixel);
+          }
+          add_clocks(span << 2);
+          continue;
         }
+
+        dot_begin();
+        add_clocks(2);
+        dot_end(pixel);
         add_clocks(2);
+        pixel++;
       }
 
       add_clocks(22);
@@ -74,7 +96,18 @@ void PPU::enter() {
   }
 }
 
+//the S-CPU synchronizes the PPU before every $2100-$213f access and counter latch,
+//so nothing the PPU depends on can change while it trails the S-CPU.
+//catch up to the S-CPU in one step, then fall back to lock-step once level with it.
 void PPU::add_clocks(unsigned clocks) {
+  if(clock < 0) {
+    unsigned span = min((int64)clocks, -clock) & ~1;
+    tick(span);
+    step(span);
+    clocks -= span;
+    synchronize_cpu();
+  }
+
   clocks >>= 1;
   while(clocks--) {
     tick(2);
@@ -101,7 +134,7 @@ void PPU::power() {
 }
 
 void PPU::reset() {
-  create(Enter, system.cpu_frequency);
+  create(Enter, system.cpu_frequency, ShallowStack);
   PPUcounter::reset();
   memset(surface, 0, 512 * 512 * sizeof(uint32));
 
@@ -48,6 +48,8 @@ private:
   Screen screen;
 
   static void Enter();
+  alwaysinline void dot_begin();
+  alwaysinline void dot_end(signed pixel);
   void add_clocks(unsigned);
 
   void scanline();
@@ -196,6 +196,8 @@ void PPU::Sprite::serialize(serializer &s) {
 
   s.integer(output.sub.priority);
   s.integer(output.sub.palette);
+
+  if(s.mode() == serializer::Load) render();
 }
 
 void PPU::Window::serialize(serializer &s) {
@@ -261,6 +263,8 @@ void PPU::Window::serialize(serializer &s) {
   s.integer(x);
   s.integer(one);
   s.integer(two);
+
+  if(s.mode() == serializer::Load) coverage.valid = false;
 }
 
 void PPU::Screen::serialize(serializer &s) {
@@ -26,6 +26,7 @@ void PPU::Sprite::scanline() {
   t.active = !t.active;
   uint8 *oam_item = t.item[t.active];
   TileItem *oam_tile = t.tile[t.active];
+  render();
 
   if(t.y == (!self.regs.overscan ? 225 : 240) && self.regs.display_disable == false) address_reset();
   if(t.y >= (!self.regs.overscan ? 224 : 239)) return;
@@ -57,33 +58,50 @@ void PPU::Sprite::run() {
   output.main.priority = 0;
   output.sub.priority = 0;
 
-  TileItem* oam_tile = t.tile[!t.active];
-  unsigned priority_table[] = { regs.priority0, regs.priority1, regs.priority2, regs.priority3 };
   unsigned x = t.x++;
+  uint8 palette = line.palette[x];
+  if(palette == 0) return;
 
-  for(unsigned n = 0; n < 34; n++) {
-    const TileItem& tile = oam_tile[n];
-    if(tile.x == 0xffff) break;
+  unsigned priority_table[] = { regs.priority0, regs.priority1, regs.priority2, regs.priority3 };
+  unsigned priority = priority_table[line.priority[x]];
 
-    int px = x - sclip<9>(tile.x);
-    if(px & ~7) continue;
+  if(regs.main_enable) {
+    output.main.palette = palette;
+    output.main.priority = priority;
+  }
 
-    unsigned mask = 0x80 >> (tile.hflip == false ? px : 7 - px);
-    unsigned color;
-    color  = ((bool)(tile.d0 & mask)) << 0;
-    color |= ((bool)(tile.d1 & mask)) << 1;
-    color |= ((bool)(tile.d2 & mask)) << 2;
-    color |= ((bool)(tile.d3 & mask)) << 3;
+  if(regs.sub_enable) {
+    output.sub.palette = palette;
+    output.sub.priority = priority;
+  }
+}
 
-    if(color) {
-      if(regs.main_enable) {
-        output.main.palette = tile.palette + color;
-        output.main.priority = priority_table[tile.priority];
-      }
+//the tiles drawn on a scanline are fetched during the previous scanline,
+//so the sprite line buffer can be resolved before the first dot is output.
+//later tiles overwrite earlier ones, matching the per-dot evaluation order
+void PPU::Sprite::render() {
+  TileItem* oam_tile = t.tile[!t.active];
+  memset(line.palette, 0, 256);
+
+  for(unsigned n = 0; n < 34; n++) {
+    const TileItem& tile = oam_tile[n];
+    if(tile.x == 0xffff) break;
 
-      if(regs.sub_enable) {
-        output.sub.palette = tile.palette + color;
-        output.sub.priority = priority_table[tile.priority];
+    signed sx = sclip<9>(tile.x);
+    for(unsigned px = 0; px < 8; px++) {
+      unsigned x = sx + px;
+      if(x >= 256) continue;
+
+      unsigned mask = 0x80 >> (tile.hflip == false ? px : 7 - px);
+      unsigned color;
+      color  = ((bool)(tile.d0 & mask)) << 0;
+      color |= ((bool)(tile.d1 & mask)) << 1;
+      color |= ((bool)(tile.d2 & mask)) << 2;
+      color |= ((bool)(tile.d3 & mask)) << 3;
+
+      if(color) {
+        line.palette[x] = tile.palette + color;
+        line.priority[x] = tile.priority;
       }
     }
   }
@@ -215,6 +233,7 @@ void PPU::Sprite::reset() {
   output.main.priority = 0;
   output.sub.palette = 0;
   output.sub.priority = 0;
+  render();
 }
 
 PPU::Sprite::Sprite(PPU &self) : self(self) {
@@ -33,6 +33,11 @@ struct Sprite {
     TileItem tile[2][34];
   } t;
 
+  struct {
+    uint8 palette[256];  //0 = transparent
+    uint8 priority[256];
+  } line;
+
   struct Regs {
     bool main_enable;
     bool sub_enable;
@@ -69,6 +74,7 @@ struct Sprite {
   void frame();
   void scanline();
   void run();
+  void render();
   void tilefetch();
   void reset();
 
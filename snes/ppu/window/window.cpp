@@ -5,79 +5,110 @@ void PPU::Window::scanline() {
 }
 
 void PPU::Window::run() {
-  bool main, sub;
-  one = (x >= regs.one_left && x <= regs.one_right);
-  two = (x >= regs.two_left && x <= regs.two_right);
+  if(coverage.valid == false) render();
+
+  uint8 main = coverage.main[x];
+  uint8 sub = coverage.sub[x];
   x++;
 
-  test(
-    main, sub,
-    regs.bg1_one_enable, regs.bg1_one_invert,
-    regs.bg1_two_enable, regs.bg1_two_invert,
-    regs.bg1_mask, regs.bg1_main_enable, regs.bg1_sub_enable
-  );
-  if(main) self.bg1.output.main.priority = 0;
-  if(sub) self.bg1.output.sub.priority = 0;
-
-  test(
-    main, sub,
-    regs.bg2_one_enable, regs.bg2_one_invert,
-    regs.bg2_two_enable, regs.bg2_two_invert,
-    regs.bg2_mask, regs.bg2_main_enable, regs.bg2_sub_enable
-  );
-  if(main) self.bg2.output.main.priority = 0;
-  if(sub) self.bg2.output.sub.priority = 0;
-
-  test(
-    main, sub,
-    regs.bg3_one_enable, regs.bg3_one_invert,
-    regs.bg3_two_enable, regs.bg3_two_invert,
-    regs.bg3_mask, regs.bg3_main_enable, regs.bg3_sub_enable
-  );
-  if(main) self.bg3.output.main.priority = 0;
-  if(sub) self.bg3.output.sub.priority = 0;
-
-  test(
-    main, sub,
-    regs.bg4_one_enable, regs.bg4_one_invert,
-    regs.bg4_two_enable, regs.bg4_two_invert,
-    regs.bg4_mask, regs.bg4_main_enable, regs.bg4_sub_enable
-  );
-  if(main) self.bg4.output.main.priority = 0;
-  if(sub) self.bg4.output.sub.priority = 0;
-
-  test(
-    main, sub,
-    regs.oam_one_enable, regs.oam_one_invert,
-    regs.oam_two_enable, regs.oam_two_invert,
-    regs.oam_mask, regs.oam_main_enable, regs.oam_sub_enable
-  );
-  if(main) self.sprite.output.main.priority = 0;
-  if(sub) self.sprite.output.sub.priority = 0;
-
-  test(
-    main, sub,
-    regs.col_one_enable, regs.col_one_invert,
-    regs.col_two_enable, regs.col_two_invert,
-    regs.col_mask, true, true
-  );
-
-  switch(regs.col_main_mask) {
-    case 0: main = true; break;
-    case 1: break;
-    case 2: main = !main; break;
-    case 3: main = false; break;
-  }
+  if(main & 0x01) self.bg1.output.main.priority = 0;
+  if(sub  & 0x01) self.bg1.output.sub.priority = 0;
+  if(main & 0x02) self.bg2.output.main.priority = 0;
+  if(sub  & 0x02) self.bg2.output.sub.priority = 0;
+  if(main & 0x04) self.bg3.output.main.priority = 0;
+  if(sub  & 0x04) self.bg3.output.sub.priority = 0;
+  if(main & 0x08) self.bg4.output.main.priority = 0;
+  if(sub  & 0x08) self.bg4.output.sub.priority = 0;
+  if(main & 0x10) self.sprite.output.main.priority = 0;
+  if(sub  & 0x10) self.sprite.output.sub.priority = 0;
+
+  output.main.color_enable = main & 0x20;
+  output.sub.color_enable = sub & 0x20;
+}
 
-  switch(regs.col_sub_mask) {
-    case 0: sub = true; break;
-    case 1: break;
-    case 2: sub = !sub; break;
-    case 3: sub = false; break;
+//window masks only change when $2123-$212b, $212e-$2130 are written:
+//evaluate them for a whole scanline once, and reuse them until then
+void PPU::Window::render() {
+  for(unsigned x = 0; x < 256; x++) {
+    bool main, sub;
+    uint8 main_mask = 0, sub_mask = 0;
+    one = (x >= regs.one_left && x <= regs.one_right);
+    two = (x >= regs.two_left && x <= regs.two_right);
+
+    test(
+      main, sub,
+      regs.bg1_one_enable, regs.bg1_one_invert,
+      regs.bg1_two_enable, regs.bg1_two_invert,
+      regs.bg1_mask, regs.bg1_main_enable, regs.bg1_sub_enable
+    );
+    main_mask |= main << 0;
+    sub_mask |= sub << 0;
+
+    test(
+      main, sub,
+      regs.bg2_one_enable, regs.bg2_one_invert,
+      regs.bg2_two_enable, regs.bg2_two_invert,
+      regs.bg2_mask, regs.bg2_main_enable, regs.bg2_sub_enable
+    );
+    main_mask |= main << 1;
+    sub_mask |= sub << 1;
+
+    test(
+      main, sub,
+      regs.bg3_one_enable, regs.bg3_one_invert,
+      regs.bg3_two_enable, regs.bg3_two_invert,
+      regs.bg3_mask, regs.bg3_main_enable, regs.bg3_sub_enable
+    );
+    main_mask |= main << 2;
+    sub_mask |= sub << 2;
+
+    test(
+      main, sub,
+      regs.bg4_one_enable, regs.bg4_one_invert,
+      regs.bg4_two_enable, regs.bg4_two_invert,
+      regs.bg4_mask, regs.bg4_main_enable, regs.bg4_sub_enable
+    );
+    main_mask |= main << 3;
+    sub_mask |= sub << 3;
+
+    test(
+      main, sub,
+      regs.oam_one_enable, regs.oam_one_invert,
+      regs.oam_two_enable, regs.oam_two_invert,
+      regs.oam_mask, regs.oam_main_enable, regs.oam_sub_enable
+    );
+    main_mask |= main << 4;
+    sub_mask |= sub << 4;
+
+    test(
+      main, sub,
+      regs.col_one_enable, regs.col_one_invert,
+      regs.col_two_enable, regs.col_two_invert,
+      regs.col_mask, true, true
+    );
+
+    switch(regs.col_main_mask) {
+      case 0: main = true; break;
+      case 1: break;
+      case 2: main = !main; break;
+      case 3: main = false; break;
+    }
+
+    switch(regs.col_sub_mask) {
+      case 0: sub = true; break;
+      case 1: break;
+      case 2: sub = !sub; break;
+      case 3: sub = false; break;
+    }
+
+    main_mask |= main << 5;
+    sub_mask |= sub << 5;
+
+    coverage.main[x] = main_mask;
+    coverage.sub[x] = sub_mask;
   }
 
-  output.main.color_enable = main;
-  output.sub.color_enable = sub;
+  coverage.valid = true;
 }
 
 void PPU::Window::test(
@@ -161,6 +192,8 @@ void PPU::Window::reset() {
   x = 0;
   one = 0;
   two = 0;
+
+  coverage.valid = false;
 }
 
 PPU::Window::Window(PPU &self) : self(self) {
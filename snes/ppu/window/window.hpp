@@ -69,8 +69,15 @@ struct Window {
     bool two;
   };
 
+  struct {
+    bool valid;
+    uint8 main[256];  //d0-d4 = BG1-BG4, OAM clipped; d5 = color window
+    uint8 sub[256];
+  } coverage;
+
   void scanline();
   void run();
+  void render();
   void reset();
 
   void test(
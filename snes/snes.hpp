@@ -4,7 +4,7 @@
 namespace SNES {
   namespace Info {
     static const char Name[] = "bsnes";
-    static const unsigned SerializerVersion = 23;
+    static const unsigned SerializerVersion = 28;
   }
 }
 
@@ -36,6 +36,9 @@ namespace SNES {
 #include <nall/varint.hpp>
 #include <nall/vector.hpp>
 #include <nall/gameboy/cartridge.hpp>
+#if defined(THREADED_APU)
+  #include <nall/thread.hpp>
+#endif
 using namespace nall;
 
 #include <gameboy/gameboy.hpp>
@@ -106,9 +109,15 @@ namespace SNES {
     unsigned frequency;
     int64 clock;
 
-    inline void create(void (*entrypoint)(), unsigned frequency) {
+    //threads that call out to the frontend (audio, input, file I/O) keep the deep stack;
+    //self-contained cores never nest more than a few frames and take the shallow one.
+    //libco pools stacks by size, so recreating a thread on reset reuses its old stack
+    static const unsigned DeepStack = 65536 * sizeof(void*);
+    static const unsigned ShallowStack = 16384 * sizeof(void*);
+
+    inline void create(void (*entrypoint)(), unsigned frequency, unsigned stacksize = DeepStack) {
       if(thread) co_delete(thread);
-      thread = co_create(65536 * sizeof(void*), entrypoint);
+      thread = co_create(stacksize, entrypoint);
       this->frequency = frequency;
       clock = 0;
     }
@@ -124,6 +133,8 @@ namespace SNES {
     }
   };
 
+  struct Coprocessor;
+
   struct ChipDebugger {
     virtual bool property(unsigned id, string &name, string &value) = 0;
   };
@@ -20,6 +20,8 @@ void Input::connect(bool port, Input::Device::e id) {
   case Device::Serial: controller = new Serial(port); break;
   }
 
+  threaded = (port1 && port1->thread) || (port2 && port2->thread);
+
   unsigned port_type = port;
   switch(port_type) {
   case Controller::Port1: config.controller_port1.i = id; break;
@@ -27,7 +29,7 @@ void Input::connect(bool port, Input::Device::e id) {
   }
 }
 
-Input::Input() : port1(0), port2(0) {
+Input::Input() : port1(0), port2(0), threaded(false) {
   connect(Controller::Port1, Input::Device::Joypad);
   connect(Controller::Port2, Input::Device::Joypad);
 }
@@ -40,6 +40,7 @@ struct Input {
 
   Controller *port1;
   Controller *port2;
+  bool threaded;  //true if either device runs its own thread (Serial)
 
   void connect(bool port, Input::Device::e id);
   Input();
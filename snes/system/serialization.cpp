@@ -53,6 +53,11 @@ void System::serialize(serializer &s) {
 }
 
 void System::serialize_all(serializer &s) {
+  #if defined(THREADED_APU)
+  //the worker writes cpu.port_data; drain it so the CPU and SMP are saved at the same point
+  smp.worker.synchronize();
+  #endif
+
   cartridge.serialize(s);
   system.serialize(s);
   random.serialize(s);
@@ -18,6 +18,9 @@ void System::run() {
   scheduler.sync.i = Scheduler::SynchronizeMode::None;
 
   scheduler.enter();
+  #if defined(THREADED_APU)
+  smp.worker.synchronize();
+  #endif
   if(scheduler.exit_reason.i == Scheduler::ExitReason::FrameEvent) {
     video.update();
   }
@@ -124,6 +127,10 @@ void System::load() {
 }
 
 void System::unload() {
+  #if defined(THREADED_APU)
+  smp.worker.stop();
+  #endif
+
   if(expansion.i == ExpansionPortDevice::BSX) bsxsatellaview.unload();
   if(cartridge.mode.i == Cartridge::Mode::Bsx) bsxcartridge.unload();
   if(cartridge.mode.i == Cartridge::Mode::SufamiTurbo) sufamiturbo.unload();